@@ -30,11 +30,15 @@
 
 #include "ParameterFramework.h"
 #include <ParameterMgrPlatformConnector.h>
+#include <CriteriaTransaction.h>
+#include <ParameterTransaction.h>
+#include <ParameterArrayView.h>
 
 #include <NonCopyable.hpp>
 
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <string>
 #include <map>
 
@@ -145,6 +149,10 @@ struct PfwHandler_ : private utility::NonCopyable
 
     pfw::Criteria criteria;
     pfw::Pfw *pfw = nullptr;
+    /** Criteria changes staged until commit, null if no transaction is in progress. */
+    std::unique_ptr<CriteriaTransaction> transaction;
+    /** Parameter writes queued until commit, null if no transaction is in progress. */
+    std::unique_ptr<ParameterTransaction> parameterTransaction;
     /** Status of the last called function.
       * Is mutable because even a const function can fail.
       */
@@ -264,7 +272,11 @@ bool pfwSetCriterion(PfwHandler *handle, const char name[], int value)
     if (criterion == nullptr) {
         return status.failure("Can not set criterion " + string(name) + " as does not exist");
     }
-    criterion->setCriterionState(value);
+    if (handle->transaction != nullptr) {
+        handle->transaction->setCriterionState(criterion, value);
+    } else {
+        criterion->setCriterionState(value);
+    }
     return status.success();
 }
 bool pfwGetCriterion(const PfwHandler *handle, const char name[], int *value)
@@ -278,7 +290,10 @@ bool pfwGetCriterion(const PfwHandler *handle, const char name[], int *value)
     if (criterion == nullptr) {
         return status.failure("Can not get criterion " + string(name) + " as it does not exist");
     }
-    *value = criterion->getCriterionState();
+    const int *staged = handle->transaction != nullptr
+                            ? handle->transaction->getCriterionState(criterion)
+                            : nullptr;
+    *value = staged != nullptr ? *staged : criterion->getCriterionState();
     return status.success();
 }
 
@@ -293,6 +308,37 @@ bool pfwApplyConfigurations(const PfwHandler *handle)
     return status.success();
 }
 
+bool pfwBeginCriteriaTransaction(PfwHandler *handle)
+{
+    Status &status = handle->lastStatus;
+    if (handle->pfw == nullptr) {
+        return status.failure("Can not begin a criteria transaction "
+                              "as the parameter framework is not started.");
+    }
+    if (handle->transaction != nullptr) {
+        return status.failure("Can not begin a criteria transaction "
+                              "as one is already in progress.");
+    }
+    handle->transaction.reset(new CriteriaTransaction);
+    return status.success();
+}
+
+bool pfwCommitCriteriaTransaction(PfwHandler *handle)
+{
+    Status &status = handle->lastStatus;
+    if (handle->transaction == nullptr) {
+        return status.failure("Can not commit a criteria transaction "
+                              "as none is in progress.");
+    }
+    bool bApplied = handle->pfw->applyCriteriaTransaction(*handle->transaction);
+    handle->transaction.reset();
+    if (!bApplied) {
+        return status.failure("Can not commit a criteria transaction "
+                              "as the parameter framework is not started.");
+    }
+    return status.success();
+}
+
 ///////////////////////////////
 /////// Parameter access //////
 ///////////////////////////////
@@ -338,6 +384,11 @@ bool pfwGetIntParameter(const PfwParameterHandler *handle, int32_t *value)
 bool pfwSetIntParameter(PfwParameterHandler *handle, int32_t value)
 {
     Status &status = handle->pfw.lastStatus;
+    ParameterTransaction *transaction = handle->pfw.parameterTransaction.get();
+    if (transaction != nullptr) {
+        return status.forward(
+            transaction->setAsSignedInteger(handle->parameter, value, status.msg()));
+    }
     return status.forward(handle->parameter.setAsSignedInteger(value, status.msg()));
 }
 
@@ -358,9 +409,65 @@ bool pfwGetStringParameter(const PfwParameterHandler *handle, char *value[])
 bool pfwSetStringParameter(PfwParameterHandler *handle, const char value[])
 {
     Status &status = handle->pfw.lastStatus;
+    ParameterTransaction *transaction = handle->pfw.parameterTransaction.get();
+    if (transaction != nullptr) {
+        return status.forward(transaction->setAsString(handle->parameter, value, status.msg()));
+    }
     return status.forward(handle->parameter.setAsString(value, status.msg()));
 }
 
+struct PfwArrayView_
+{
+    ParameterArrayView view;
+};
+
+PfwArrayView *pfwGetArrayView(const PfwParameterHandler *handle, const void **data,
+                              size_t *length, size_t *stride)
+{
+    Status &status = handle->pfw.lastStatus;
+    std::unique_ptr<PfwArrayView> arrayView(
+        new PfwArrayView{handle->parameter.getArrayView(status.msg())});
+    if (not arrayView->view.isValid()) {
+        return nullptr;
+    }
+    *data = arrayView->view.getData();
+    *length = arrayView->view.getLength();
+    *stride = arrayView->view.getStride();
+    status.success();
+    return arrayView.release();
+}
+
+void pfwReleaseArrayView(PfwArrayView *view)
+{
+    delete view;
+}
+
+bool pfwBeginParameterTransaction(PfwHandler *handle)
+{
+    Status &status = handle->lastStatus;
+    if (handle->pfw == nullptr) {
+        return status.failure("Can not begin a parameter transaction "
+                              "as the parameter framework is not started.");
+    }
+    if (handle->parameterTransaction != nullptr) {
+        return status.failure("Can not begin a parameter transaction "
+                              "as one is already in progress.");
+    }
+    handle->parameterTransaction.reset(handle->pfw->createParameterTransaction());
+    return status.success();
+}
+
+bool pfwCommitParameterTransaction(PfwHandler *handle)
+{
+    Status &status = handle->lastStatus;
+    if (handle->parameterTransaction == nullptr) {
+        return status.failure("Can not commit a parameter transaction "
+                              "as none is in progress.");
+    }
+    std::unique_ptr<ParameterTransaction> transaction(std::move(handle->parameterTransaction));
+    return status.forward(transaction->commit(status.msg()));
+}
+
 void pfwFree(void *ptr)
 {
     std::free(ptr);
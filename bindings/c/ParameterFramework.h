@@ -188,6 +188,8 @@ const char *pfwGetLastError(const PfwHandler *handle) NONNULL;
   *
   * Criterion change do not have impact on the parameters value
   * (no configuration applied) until the changes are committed using pfwApplyConfigurations.
+  * While a criteria transaction is in progress, the change is only staged until
+  * pfwCommitCriteriaTransaction. @see pfwBeginCriteriaTransaction
   *
   * @return true on success and false on failure.
   */
@@ -213,6 +215,29 @@ bool pfwGetCriterion(const PfwHandler *handle, const char name[], int *value) NO
 CPARAMETER_EXPORT
 bool pfwApplyConfigurations(const PfwHandler *handle) NONNULL USERESULT;
 
+/** Start staging criteria changes, to publish and apply them all at once.
+  * Until pfwCommitCriteriaTransaction, pfwSetCriterion only stages the changes
+  * and pfwGetCriterion returns the staged values.
+  *
+  * @param[in] handle @see PfwHandler
+  * @return true on success and false on failure,
+  *         ie. if a transaction is already in progress.
+  */
+CPARAMETER_EXPORT
+bool pfwBeginCriteriaTransaction(PfwHandler *handle) NONNULL USERESULT;
+
+/** Publish the staged criteria changes and apply the configurations.
+  * No configuration application can happen while the changes are published,
+  * so no intermediate criteria combination is ever applied. Rules are evaluated
+  * and parameters synchronized only once.
+  *
+  * @param[in] handle @see PfwHandler
+  * @return true on success and false on failure,
+  *         ie. if no transaction is in progress.
+  */
+CPARAMETER_EXPORT
+bool pfwCommitCriteriaTransaction(PfwHandler *handle) NONNULL USERESULT;
+
 ///////////////////////////////
 /////// Parameter access //////
 ///////////////////////////////
@@ -253,6 +278,8 @@ CPARAMETER_EXPORT
 bool pfwGetIntParameter(const PfwParameterHandler *handle, int32_t *value) NONNULL USERESULT;
 
 /** Set the value of a previously bind int parameter.
+  * While a parameter transaction is in progress, the write is only queued until
+  * pfwCommitParameterTransaction. @see pfwBeginParameterTransaction
   * @param[in] handle Handler to a valid parameter.
   * @param[in] value The parameter value to set.
   * return true of success, false on failure.
@@ -272,12 +299,71 @@ CPARAMETER_EXPORT
 bool pfwGetStringParameter(const PfwParameterHandler *handle, char *value[]) NONNULL;
 
 /** Set the value of a previously bind string parameter.
+  * While a parameter transaction is in progress, the write is only queued until
+  * pfwCommitParameterTransaction. @see pfwBeginParameterTransaction
   * @param[in] handle Handler to a valid parameter
   * @param[in] value Non null pointer to a null terminated string to set.
   */
 CPARAMETER_EXPORT
 bool pfwSetStringParameter(PfwParameterHandler *handle, const char value[]) NONNULL USERESULT;
 
+/** Read only view of the content of an array parameter, without copy.
+  * A PfwArrayView* is valid if:
+  *  - it was created by pfwGetArrayView
+  *  - it has not been released by pfwReleaseArrayView
+  * Any created view MUST be released (with pfwReleaseArrayView) before
+  * the PfwParameterHandler that was used for its creation is destroyed.
+  * @note Forward declaration to break header dependency.
+  */
+struct PfwArrayView_;
+typedef struct PfwArrayView_ PfwArrayView;
+
+/** View the content of a previously bind array parameter.
+  * The content is the little endian encoding of the array elements, as in the
+  * parameter blackboard: *length elements of *stride bytes, the first one at *data.
+  * Views must be short lived: while the parameter framework is in tuning mode,
+  * they lock the parameters until released.
+  *
+  * @param[in] handle Handler to a valid array parameter.
+  * @param[out] data Will point to the first element on success, undefined otherwise.
+  *                  Valid until the view is released.
+  * @param[out] length Will hold the number of elements on success, undefined otherwise.
+  * @param[out] stride Will hold the size of an element in bytes on success,
+  *                    undefined otherwise.
+  * @return a PfwArrayView on success, NULL on error.
+  *         @see pfwGetLastError for error detail.
+  */
+CPARAMETER_EXPORT
+PfwArrayView *pfwGetArrayView(const PfwParameterHandler *handle, const void **data,
+                              size_t *length, size_t *stride) NONNULL USERESULT;
+
+/** Release a view, invalidating its data. Can not fail. */
+CPARAMETER_EXPORT
+void pfwReleaseArrayView(PfwArrayView *view) NONNULL;
+
+/** Start queuing parameter writes, to do them all at once.
+  * Until pfwCommitParameterTransaction, pfwSetIntParameter and pfwSetStringParameter
+  * only queue the writes; parameter getters still return the current values.
+  *
+  * @param[in] handle @see PfwHandler
+  * @return true on success and false on failure,
+  *         ie. if a transaction is already in progress.
+  */
+CPARAMETER_EXPORT
+bool pfwBeginParameterTransaction(PfwHandler *handle) NONNULL USERESULT;
+
+/** Do the queued parameter writes and synchronize the written parameters.
+  * All writes are done or none: if one fails, the parameters are left unmodified.
+  * Each syncer is synchronized only once, however many of its parameters were written.
+  * The transaction is over afterwards, whatever the result.
+  *
+  * @param[in] handle @see PfwHandler
+  * @return true on success and false on failure,
+  *         ie. if no transaction is in progress, or if a write or synchronization failed.
+  */
+CPARAMETER_EXPORT
+bool pfwCommitParameterTransaction(PfwHandler *handle) NONNULL USERESULT;
+
 /** Frees the memory space pointed to by ptr,
   *  which must have been returned by a previous call to the pfw.
   *
@@ -125,12 +125,15 @@ TEST_CASE_METHOD(Test, "Parameter-framework c api use")
     // Create valid pfw config file
     const char *intParameterPath = "/test/system/integer";
     const char *stringParameterPath = "/test/system/string";
+    const char *arrayParameterPath = "/test/system/integers";
     TmpFile system("<?xml version='1.0' encoding='UTF-8'?>\
         <Subsystem Name='system' Type='Virtual'>\
             <ComponentLibrary/>\
             <InstanceDefinition>\
                 <IntegerParameter Name='integer' Size='32' Signed='true' Max='100'/>\
                 <StringParameter Name='string' MaxLength='9'/>\
+                <IntegerParameter Name='integers' Size='16' Signed='true' Min='-100'\
+                                  Max='100' ArrayLength='3'/>\
             </InstanceDefinition>\
         </Subsystem>");
     TmpFile libraries("<?xml version='1.0' encoding='UTF-8'?>\
@@ -257,6 +260,12 @@ TEST_CASE_METHOD(Test, "Parameter-framework c api use")
         WHEN ("Commit criteria of a stopped pfw") {
             REQUIRE_FAILURE(pfwApplyConfigurations(pfw));
         }
+        WHEN ("Begin a criteria transaction on a stopped pfw") {
+            REQUIRE_FAILURE(pfwBeginCriteriaTransaction(pfw));
+        }
+        WHEN ("Begin a parameter transaction on a stopped pfw") {
+            REQUIRE_FAILURE(pfwBeginParameterTransaction(pfw));
+        }
 
         WHEN ("Bind parameter with a stopped pfw") {
             REQUIRE(pfwBindParameter(pfw, intParameterPath) == NULL);
@@ -310,6 +319,43 @@ TEST_CASE_METHOD(Test, "Parameter-framework c api use")
             WHEN ("Commit criteria of a started pfw") {
                 REQUIRE_SUCCESS(pfwApplyConfigurations(pfw));
             }
+            WHEN ("Commit a criteria transaction that was not begun") {
+                REQUIRE_FAILURE(pfwCommitCriteriaTransaction(pfw));
+            }
+            WHEN ("Set criteria within a transaction") {
+                REQUIRE_SUCCESS(pfwBeginCriteriaTransaction(pfw));
+                REQUIRE_FAILURE(pfwBeginCriteriaTransaction(pfw));
+                for (size_t i = 0; i < criterionNb; ++i) {
+                    const char *criterionName = criteria[i].name;
+                    CAPTURE(criterionName);
+                    REQUIRE_SUCCESS(pfwSetCriterion(pfw, criterionName, 1));
+                    REQUIRE_SUCCESS(pfwSetCriterion(pfw, criterionName, 2));
+                }
+                THEN ("Get criterion value should return what was staged") {
+                    for (size_t i = 0; i < criterionNb; ++i) {
+                        const char *criterionName = criteria[i].name;
+                        CAPTURE(criterionName);
+                        REQUIRE_SUCCESS(pfwGetCriterion(pfw, criterionName, &value));
+                        REQUIRE(value == 2);
+                    }
+                }
+                WHEN ("Committing the transaction") {
+                    REQUIRE_SUCCESS(pfwCommitCriteriaTransaction(pfw));
+                    THEN ("Changes are published at once, without warnings") {
+                        for (size_t i = 0; i < criterionNb; ++i) {
+                            const char *criterionName = criteria[i].name;
+                            CAPTURE(criterionName);
+                            REQUIRE_SUCCESS(pfwGetCriterion(pfw, criterionName, &value));
+                            REQUIRE(value == 2);
+                        }
+                        INFO("Previous pfw log: \n" + logLines);
+                        CHECK(logLines.find("Selection criteria changed event:") !=
+                              std::string::npos);
+                        CHECK(logLines.find("without any configuration application") ==
+                              std::string::npos);
+                    }
+                }
+            }
             WHEN ("Bind a non existing parameter") {
                 REQUIRE_FAILURE(pfwBindParameter(pfw, "do/not/exist") != nullptr);
             }
@@ -353,6 +399,92 @@ TEST_CASE_METHOD(Test, "Parameter-framework c api use")
 
                 pfwUnbindParameter(param);
             }
+
+            GIVEN ("An array parameter handle") {
+                PfwParameterHandler *param = pfwBindParameter(pfw, arrayParameterPath);
+                REQUIRE_SUCCESS(param != nullptr);
+
+                WHEN ("Viewing its content") {
+                    const void *data;
+                    size_t length;
+                    size_t stride;
+                    PfwArrayView *view = pfwGetArrayView(param, &data, &length, &stride);
+                    REQUIRE_SUCCESS(view != nullptr);
+                    REQUIRE(view != nullptr);
+                    THEN ("The view is on the array elements") {
+                        CHECK(length == 3);
+                        CHECK(stride == 2);
+                        auto *elements = static_cast<const int16_t *>(data);
+                        CHECK(elements[0] == -100);
+                        CHECK(elements[2] == -100);
+                    }
+                    pfwReleaseArrayView(view);
+                }
+                pfwUnbindParameter(param);
+            }
+            WHEN ("Viewing the content of a scalar parameter") {
+                PfwParameterHandler *param = pfwBindParameter(pfw, intParameterPath);
+                REQUIRE_SUCCESS(param != nullptr);
+                const void *data;
+                size_t length;
+                size_t stride;
+                REQUIRE_FAILURE(pfwGetArrayView(param, &data, &length, &stride) != nullptr);
+                pfwUnbindParameter(param);
+            }
+
+            GIVEN ("Parameter handles and a parameter transaction") {
+                PfwParameterHandler *intParam = pfwBindParameter(pfw, intParameterPath);
+                REQUIRE_SUCCESS(intParam != nullptr);
+                PfwParameterHandler *stringParam = pfwBindParameter(pfw, stringParameterPath);
+                REQUIRE_SUCCESS(stringParam != nullptr);
+                REQUIRE_SUCCESS(pfwSetIntParameter(intParam, 5));
+                REQUIRE_SUCCESS(pfwSetStringParameter(stringParam, "initial"));
+
+                WHEN ("Commit a parameter transaction that was not begun") {
+                    REQUIRE_FAILURE(pfwCommitParameterTransaction(pfw));
+                }
+                REQUIRE_SUCCESS(pfwBeginParameterTransaction(pfw));
+
+                WHEN ("Begin a parameter transaction twice") {
+                    REQUIRE_FAILURE(pfwBeginParameterTransaction(pfw));
+                    REQUIRE_SUCCESS(pfwCommitParameterTransaction(pfw));
+                }
+                WHEN ("Set parameters within the transaction") {
+                    REQUIRE_SUCCESS(pfwSetIntParameter(intParam, 12));
+                    REQUIRE_SUCCESS(pfwSetStringParameter(stringParam, "batched"));
+                    THEN ("Parameters are not written before commit") {
+                        REQUIRE_SUCCESS(pfwGetIntParameter(intParam, &value));
+                        CHECK(value == 5);
+                    }
+                    WHEN ("Committing the transaction") {
+                        REQUIRE_SUCCESS(pfwCommitParameterTransaction(pfw));
+                        THEN ("All parameters are written") {
+                            char *stringValue;
+                            REQUIRE_SUCCESS(pfwGetIntParameter(intParam, &value));
+                            CHECK(value == 12);
+                            REQUIRE_SUCCESS(pfwGetStringParameter(stringParam, &stringValue));
+                            CHECK(stringValue == std::string("batched"));
+                            pfwFree(stringValue);
+                        }
+                    }
+                }
+                WHEN ("A write of the transaction is out of range") {
+                    REQUIRE_SUCCESS(pfwSetStringParameter(stringParam, "batched"));
+                    REQUIRE_SUCCESS(pfwSetIntParameter(intParam, 101));
+                    REQUIRE_FAILURE(pfwCommitParameterTransaction(pfw));
+                    THEN ("No parameter is written") {
+                        char *stringValue;
+                        REQUIRE_SUCCESS(pfwGetStringParameter(stringParam, &stringValue));
+                        CHECK(stringValue == std::string("initial"));
+                        pfwFree(stringValue);
+                        REQUIRE_SUCCESS(pfwGetIntParameter(intParam, &value));
+                        CHECK(value == 5);
+                    }
+                }
+
+                pfwUnbindParameter(stringParam);
+                pfwUnbindParameter(intParam);
+            }
         }
 
         pfwDestroy(pfw);
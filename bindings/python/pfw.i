@@ -64,8 +64,27 @@ namespace std {
 %feature("autodoc", "1");
 
 
+// Element handles are not wrapped, parameters are written by path
+%nodefaultctor ParameterTransaction;
+class ParameterTransaction
+{
+%{
+#include "ParameterTransaction.h"
+%}
+
+public:
+    bool setValue(const std::string& path, const std::string& value, std::string& strError);
+    size_t getWriteCount() const;
+    void clear();
+    bool commit(std::string& strError);
+
+    ~ParameterTransaction();
+};
+
 // rename "CParameterMgrFullConnector" into the nicer "ParameterFramework" name
 %rename(ParameterFramework) CParameterMgrFullConnector;
+// Created transactions are owned by the caller
+%newobject CParameterMgrFullConnector::createParameterTransaction;
 class CParameterMgrFullConnector
 {
 
@@ -88,6 +107,9 @@ public:
     // Configuration application
     void applyConfigurations();
 
+    // Batched parameter writes
+    ParameterTransaction* createParameterTransaction() const;
+
     bool getForceNoRemoteInterface() const;
     void setForceNoRemoteInterface(bool bForceNoRemoteInterface);
 
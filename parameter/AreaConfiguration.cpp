@@ -30,22 +30,25 @@
 #include "AreaConfiguration.h"
 #include "ConfigurableElement.h"
 #include "ConfigurationAccessContext.h"
+#include "RestorePlan.h"
+#include "DomainsBundle.h"
 #include <assert.h>
 
 CAreaConfiguration::CAreaConfiguration(const CConfigurableElement *pConfigurableElement,
                                        const CSyncerSet *pSyncerSet)
-    : _pConfigurableElement(pConfigurableElement), _pSyncerSet(pSyncerSet)
+    : _pConfigurableElement(pConfigurableElement), _pSyncerSet(pSyncerSet),
+      _size(pConfigurableElement->getFootPrint())
 {
     // Size blackboard
-    _blackboard.setSize(_pConfigurableElement->getFootPrint());
+    _blackboard.setSize(_size);
 }
 
 CAreaConfiguration::CAreaConfiguration(const CConfigurableElement *pConfigurableElement,
                                        const CSyncerSet *pSyncerSet, size_t size)
-    : _pConfigurableElement(pConfigurableElement), _pSyncerSet(pSyncerSet)
+    : _pConfigurableElement(pConfigurableElement), _pSyncerSet(pSyncerSet), _size(size)
 {
     // Size blackboard
-    _blackboard.setSize(size);
+    _blackboard.setSize(_size);
 }
 
 // Save data from current
@@ -66,6 +69,46 @@ bool CAreaConfiguration::restore(CParameterBlackboard *pMainBlackboard, bool bSy
     return !bSync || _pSyncerSet->sync(*pMainBlackboard, false, errors);
 }
 
+bool CAreaConfiguration::restoreDelta(CParameterBlackboard *pMainBlackboard,
+                                      const CAreaConfiguration &fromAreaConfiguration,
+                                      Delta &delta) const
+{
+    assert(_bValid);
+    assert(_pConfigurableElement == fromAreaConfiguration._pConfigurableElement);
+
+    const CParameterBlackboard &fromBlackboard = fromAreaConfiguration._blackboard;
+
+    // Any modification of either configuration invalidates the ranges
+    if (!delta.bValid || delta.uiFromGeneration != fromBlackboard.getGeneration() ||
+        delta.uiToGeneration != _blackboard.getGeneration()) {
+
+        _blackboard.gatherDifferences(fromBlackboard, delta.ranges);
+
+        delta.uiFromGeneration = fromBlackboard.getGeneration();
+        delta.uiToGeneration = _blackboard.getGeneration();
+        delta.bValid = true;
+    }
+    if (delta.ranges.empty()) {
+
+        return false;
+    }
+    copyRangesTo(pMainBlackboard, _pConfigurableElement->getOffset(), delta.ranges);
+
+    return true;
+}
+
+void CAreaConfiguration::addToRestorePlan(CRestorePlan &plan) const
+{
+    assert(_bValid);
+
+    plan.addCopy(_blackboard, _pConfigurableElement->getOffset());
+}
+
+const CSyncerSet &CAreaConfiguration::getSyncerSet() const
+{
+    return *_pSyncerSet;
+}
+
 // Ensure validity
 void CAreaConfiguration::validate(const CParameterBlackboard *pMainBlackboard)
 {
@@ -155,6 +198,65 @@ void CAreaConfiguration::copyFromOuter(const CAreaConfiguration *pFromAreaConfig
     setValid(true);
 }
 
+void CAreaConfiguration::toBundle(CDomainsBundleWriter &writer) const
+{
+    writer.write(static_cast<uint8_t>(_bValid));
+    writer.write(static_cast<uint64_t>(_blackboard.getSize()));
+
+    if (_blackboard.getSize() != 0) {
+
+        writer.writeBytes(_blackboard.getLocation(0), _blackboard.getSize());
+    }
+}
+
+bool CAreaConfiguration::fromBundle(CDomainsBundleReader &reader,
+                                    const uint8_t **ppLazySettings)
+{
+    uint8_t valid;
+    uint64_t size;
+
+    if (!reader.read(valid) || !reader.read(size)) {
+
+        return false;
+    }
+    if (size != _blackboard.getSize()) {
+
+        return reader.fail("Settings size mismatch for " + _pConfigurableElement->getPath() +
+                           " in domains bundle");
+    }
+    const uint8_t *data = reader.readBytes(_blackboard.getSize());
+
+    if (data == nullptr) {
+
+        return false;
+    }
+    if (ppLazySettings != nullptr && valid && size != 0) {
+
+        *ppLazySettings = data;
+        releaseSettings();
+        return true;
+    }
+    if (size != 0) {
+
+        // No value parsing: settings are stored as they are in the blackboard
+        _blackboard.writeBuffer(data, _blackboard.getSize(), 0);
+    }
+    setValid(valid != 0);
+    return true;
+}
+
+// Lazy settings support
+void CAreaConfiguration::releaseSettings()
+{
+    _blackboard.release();
+    _bValid = true;
+}
+
+void CAreaConfiguration::allocateSettings()
+{
+    _blackboard.setSize(_size);
+}
+
 CParameterBlackboard &CAreaConfiguration::getBlackboard()
 {
     return _blackboard;
@@ -181,3 +283,12 @@ void CAreaConfiguration::copyFrom(const CParameterBlackboard *pFromBlackboard, s
 {
     pFromBlackboard->saveTo(&_blackboard, offset);
 }
+
+void CAreaConfiguration::copyRangesTo(CParameterBlackboard *pToBlackboard, size_t offset,
+                                      const CParameterBlackboard::Ranges &ranges) const
+{
+    for (const auto &range : ranges) {
+
+        pToBlackboard->restoreFrom(&_blackboard, offset, range);
+    }
+}
@@ -36,10 +36,25 @@
 class CConfigurableElement;
 class CXmlElement;
 class CConfigurationAccessContext;
+class CRestorePlan;
+class CDomainsBundleWriter;
+class CDomainsBundleReader;
 
 class CAreaConfiguration
 {
 public:
+    /** Byte ranges differing between two area configurations of the same element */
+    struct Delta
+    {
+        // Whether ranges have been computed
+        bool bValid{false};
+        // Blackboard generations the ranges were computed from
+        uint64_t uiFromGeneration{0};
+        uint64_t uiToGeneration{0};
+        // Differing ranges, relative to the area
+        CParameterBlackboard::Ranges ranges;
+    };
+
     CAreaConfiguration(const CConfigurableElement *pConfigurableElement,
                        const CSyncerSet *pSyncerSet);
 
@@ -57,6 +72,25 @@ public:
      */
     bool restore(CParameterBlackboard *pMainBlackboard, bool bSync, core::Results *errors) const;
 
+    /** Restore what differs from another configuration of the area
+     *
+     * The main blackboard is expected to hold the other configuration of the area.
+     *
+     * @param[in] pMainBlackboard the application main blackboard
+     * @param[in] fromAreaConfiguration the area configuration held by the main blackboard
+     * @param[in,out] delta the ranges differing from fromAreaConfiguration, computed again if
+     *                either configuration was modified since
+     * @return true if anything was restored, false if both configurations are identical
+     */
+    bool restoreDelta(CParameterBlackboard *pMainBlackboard,
+                      const CAreaConfiguration &fromAreaConfiguration, Delta &delta) const;
+
+    // Append the restoration of the area to a restore plan
+    virtual void addToRestorePlan(CRestorePlan &plan) const;
+
+    // Syncer set of the element
+    const CSyncerSet &getSyncerSet() const;
+
     // Ensure validity
     void validate(const CParameterBlackboard *pMainBlackboard);
 
@@ -79,6 +113,27 @@ public:
     bool serializeXmlSettings(CXmlElement &xmlConfigurableElementSettingsElementContent,
                               CConfigurationAccessContext &configurationAccessContext);
 
+    /** Domains bundle settings serialization, as raw blackboard content
+     *
+     * The element index is handled by the domain configuration, to find the area to read.
+     * @{
+     */
+    void toBundle(CDomainsBundleWriter &writer) const;
+    /** @param[out] ppLazySettings if not null, valid settings are not copied but left in the
+     *              bundle: their location is returned and the settings released */
+    bool fromBundle(CDomainsBundleReader &reader, const uint8_t **ppLazySettings = nullptr);
+    /** @} */
+
+    /** Lazy settings support
+     *
+     * Released settings are those of a lazy domain configuration, which decodes them once
+     * allocated again. The area is considered valid meanwhile.
+     * @{
+     */
+    void releaseSettings();
+    void allocateSettings();
+    /** @} */
+
     // Fetch the Configuration Blackboard
     CParameterBlackboard &getBlackboard();
     const CParameterBlackboard &getBlackboard() const;
@@ -91,6 +146,8 @@ private:
     // Blackboard copies
     virtual void copyTo(CParameterBlackboard *pToBlackboard, size_t offset) const;
     virtual void copyFrom(const CParameterBlackboard *pFromBlackboard, size_t offset);
+    virtual void copyRangesTo(CParameterBlackboard *pToBlackboard, size_t offset,
+                              const CParameterBlackboard::Ranges &ranges) const;
 
     // Store validity
     void setValid(bool bValid);
@@ -106,6 +163,9 @@ private:
     // Syncer set (required for immediate synchronization)
     const CSyncerSet *_pSyncerSet;
 
+    // Blackboard size, kept to allocate released settings
+    const size_t _size;
+
     // Area configuration validity (invalid area configurations can't be restored)
     bool _bValid{false};
 };
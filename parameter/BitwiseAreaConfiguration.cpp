@@ -30,6 +30,7 @@
 #include "BitwiseAreaConfiguration.h"
 #include "BitParameter.h"
 #include "Subsystem.h"
+#include "RestorePlan.h"
 
 #define base CAreaConfiguration
 
@@ -40,6 +41,16 @@ CBitwiseAreaConfiguration::CBitwiseAreaConfiguration(
 {
 }
 
+void CBitwiseAreaConfiguration::addToRestorePlan(CRestorePlan &plan) const
+{
+    const CBitParameter *pBitParameter = static_cast<const CBitParameter *>(_pConfigurableElement);
+
+    // The bits of the block belonging to the parameter
+    uint64_t uiMask = pBitParameter->merge(0, ~uint64_t{0});
+
+    plan.addMaskedMerge(_blackboard, pBitParameter->getOffset(), uiMask);
+}
+
 // Blackboard copies
 void CBitwiseAreaConfiguration::copyTo(CParameterBlackboard *pToBlackboard, size_t offset) const
 {
@@ -86,3 +97,10 @@ void CBitwiseAreaConfiguration::copyFrom(const CParameterBlackboard *pFromBlackb
     // Write dst blackboard
     _blackboard.writeInteger(&uiDstData, pBitParameter->getBelongingBlockSize(), 0);
 }
+
+void CBitwiseAreaConfiguration::copyRangesTo(CParameterBlackboard *pToBlackboard, size_t offset,
+                                             const CParameterBlackboard::Ranges & /*ranges*/) const
+{
+    // Bits are merged into the whole block anyway
+    copyTo(pToBlackboard, offset);
+}
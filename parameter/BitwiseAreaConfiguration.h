@@ -39,8 +39,12 @@ public:
     CBitwiseAreaConfiguration(const CConfigurableElement *pConfigurableElement,
                               const CSyncerSet *pSyncerSet);
 
+    void addToRestorePlan(CRestorePlan &plan) const override;
+
 private:
     // Blackboard copies
     void copyTo(CParameterBlackboard *pToBlackboard, size_t offset) const override;
     void copyFrom(const CParameterBlackboard *pFromBlackboard, size_t offset) override;
+    void copyRangesTo(CParameterBlackboard *pToBlackboard, size_t offset,
+                      const CParameterBlackboard::Ranges &ranges) const override;
 };
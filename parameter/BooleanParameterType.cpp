@@ -29,6 +29,7 @@
  */
 #include "BooleanParameterType.h"
 #include "ParameterAccessContext.h"
+#include "BoundParameter.h"
 #include "Utility.h"
 
 #define base CParameterType
@@ -123,3 +124,12 @@ bool CBooleanParameterType::fromBlackboard(uint32_t &uiUserValue, uint32_t uiVal
 
     return true;
 }
+
+// Precompiled accessors
+bool CBooleanParameterType::getScalarCodec(ScalarCodec &codec) const
+{
+    codec.kind = ScalarCodec::Kind::Boolean;
+    codec.size = getSize();
+
+    return true;
+}
@@ -58,4 +58,7 @@ public:
                       CParameterAccessContext &parameterAccessContext) const override;
     bool fromBlackboard(uint32_t &uiUserValue, uint32_t uiValue,
                         CParameterAccessContext &parameterAccessContext) const override;
+
+    // Precompiled accessors
+    bool getScalarCodec(ScalarCodec &codec) const override;
 };
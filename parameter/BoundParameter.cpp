@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "BoundParameter.h"
+#include "ScalarCodecConversion.h"
+#include "Parameter.h"
+#include "ParameterAccessContext.h"
+#include "ParameterBlackboard.h"
+#include "ParameterMgr.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+
+using Kind = ScalarCodec::Kind;
+using Adaptation = ScalarCodec::Adaptation;
+
+using namespace scalarCodec;
+
+template <class T>
+BoundParameter<T>::BoundParameter(const CParameter &parameter, CParameterMgr &parameterMgr,
+                                  const ScalarCodec &codec)
+    : mParameter(&parameter), mParameterMgr(&parameterMgr), mOffset(parameter.getOffset()),
+      mCodec(codec)
+{
+}
+
+template <class T>
+bool BoundParameter<T>::isBound() const
+{
+    return mParameter != nullptr;
+}
+
+template <class T>
+bool BoundParameter<T>::get(T &value) const
+{
+    if (!mParameter) {
+
+        return false;
+    }
+    uint32_t data = 0;
+    {
+        // Read the published content, as ElementHandle does
+        CParameterMgr::CBlackboardReader reader(*mParameterMgr, mParameter);
+
+        // Beware this code works on little endian architectures only!
+        reader.getBlackboard()->readInteger(&data, mCodec.size, mOffset);
+    }
+    value = decode(data);
+    return true;
+}
+
+template <class T>
+bool BoundParameter<T>::set(T value)
+{
+    if (!mParameter || !mParameter->belongsToNoDomainAscending()) {
+
+        return false;
+    }
+    // When in tuning mode, silently skip "set" requests
+    if (mParameterMgr->tuningModeOn()) {
+
+        return true;
+    }
+    uint32_t data;
+
+    if (!encode(value, data)) {
+
+        return false;
+    }
+    CParameterMgr::CBlackboardLock lock(*mParameterMgr, mParameter);
+    CParameterBlackboard *pBlackboard = mParameterMgr->getParameterBlackboard();
+
+    // Beware this code works on little endian architectures only!
+    pBlackboard->writeInteger(&data, mCodec.size, mOffset);
+
+    // The error is only allocated if the synchronization fails
+    std::string strError;
+    CParameterAccessContext parameterAccessContext(strError, pBlackboard);
+
+    if (!mParameter->sync(parameterAccessContext)) {
+
+        return false;
+    }
+    mParameterMgr->publishBlackboardSnapshot();
+    return true;
+}
+
+// Boolean
+template <>
+bool BoundParameter<bool>::isSupported(const ScalarCodec &codec)
+{
+    return codec.kind == Kind::Boolean;
+}
+
+template <>
+bool BoundParameter<bool>::encode(bool value, uint32_t &data) const
+{
+    data = value;
+    return true;
+}
+
+template <>
+bool BoundParameter<bool>::decode(uint32_t data) const
+{
+    return data != 0;
+}
+
+// Integer
+template <>
+bool BoundParameter<uint32_t>::isSupported(const ScalarCodec &codec)
+{
+    return codec.kind == Kind::Boolean || codec.kind == Kind::Integer;
+}
+
+template <>
+bool BoundParameter<uint32_t>::encode(uint32_t value, uint32_t &data) const
+{
+    if (mCodec.kind == Kind::Boolean) {
+
+        if (value > 1) {
+
+            return false;
+        }
+    } else if (value < static_cast<uint32_t>(mCodec.min) ||
+               value > static_cast<uint32_t>(mCodec.max)) {
+
+        return false;
+    }
+    data = value;
+    return true;
+}
+
+template <>
+uint32_t BoundParameter<uint32_t>::decode(uint32_t data) const
+{
+    return mCodec.kind == Kind::Boolean ? data != 0 : data;
+}
+
+// Signed integer
+template <>
+bool BoundParameter<int32_t>::isSupported(const ScalarCodec &codec)
+{
+    return codec.kind == Kind::Integer;
+}
+
+template <>
+bool BoundParameter<int32_t>::encode(int32_t value, uint32_t &data) const
+{
+    if (value < static_cast<int32_t>(mCodec.min) || value > static_cast<int32_t>(mCodec.max)) {
+
+        return false;
+    }
+    data = static_cast<uint32_t>(value);
+    return true;
+}
+
+template <>
+int32_t BoundParameter<int32_t>::decode(uint32_t data) const
+{
+    return signExtend(data, mCodec.size);
+}
+
+// Double
+template <>
+bool BoundParameter<double>::isSupported(const ScalarCodec &codec)
+{
+    return (codec.kind == Kind::Integer && codec.adaptation != Adaptation::None) ||
+           codec.kind == Kind::FixedPoint || codec.kind == Kind::FloatingPoint;
+}
+
+template <>
+bool BoundParameter<double>::encode(double value, uint32_t &data) const
+{
+    switch (mCodec.kind) {
+    case Kind::Integer: {
+        int64_t encoded = fromUserValue(mCodec, value);
+
+        if (encoded < mCodec.min || encoded > mCodec.max) {
+
+            return false;
+        }
+        data = static_cast<uint32_t>(encoded);
+        return true;
+    }
+    case Kind::FixedPoint: {
+        if (value < mCodec.doubleMin || value > mCodec.doubleMax) {
+
+            return false;
+        }
+        // Multiply by 2^fractional, round to the nearest integer and left justify
+        auto encoded =
+            static_cast<int32_t>(round(value * double(1UL << mCodec.fractional)));
+        data = static_cast<uint32_t>(encoded) << mCodec.justification;
+        return true;
+    }
+    default: {
+        // Check the value fits in a float before converting it
+        if (value < -std::numeric_limits<float>::max() ||
+            value > std::numeric_limits<float>::max()) {
+
+            return false;
+        }
+        float encoded = static_cast<float>(value);
+
+        if (encoded < mCodec.doubleMin || encoded > mCodec.doubleMax) {
+
+            return false;
+        }
+        memcpy(&data, &encoded, sizeof(data));
+        return true;
+    }
+    }
+}
+
+template <>
+double BoundParameter<double>::decode(uint32_t data) const
+{
+    switch (mCodec.kind) {
+    case Kind::Integer:
+        return toUserValue(mCodec, mCodec.isSigned ? int64_t{signExtend(data, mCodec.size)}
+                                                   : int64_t{data});
+    case Kind::FixedPoint:
+        return fixedPointToUserValue(mCodec, data);
+    default:
+        return floatingPointToUserValue(data);
+    }
+}
+
+template class BoundParameter<bool>;
+template class BoundParameter<uint32_t>;
+template class BoundParameter<int32_t>;
+template class BoundParameter<double>;
@@ -28,7 +28,10 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include "CompoundRule.h"
+#include "SelectionCriterionRule.h"
+#include "DomainsBundle.h"
 #include "RuleParser.h"
+#include "RuleProgram.h"
 
 #define base CRule
 
@@ -125,6 +128,60 @@ bool CCompoundRule::matches() const
     return _bTypeAll;
 }
 
+// Criteria dependencies
+void CCompoundRule::gatherCriteria(std::set<const CSelectionCriterion *> &criteria) const
+{
+    size_t uiChild;
+    size_t uiNbChildren = getNbChildren();
+
+    for (uiChild = 0; uiChild < uiNbChildren; uiChild++) {
+
+        const CRule *pRule = static_cast<const CRule *>(getChild(uiChild));
+
+        pRule->gatherCriteria(criteria);
+    }
+}
+
+// Rule compilation
+void CCompoundRule::compile(CRuleProgram &program, size_t onTrue, size_t onFalse) const
+{
+    size_t uiChild;
+    size_t uiNbChildren = getNbChildren();
+
+    if (uiNbChildren == 0) {
+
+        // Empty rules are constant: All{} matches, Any{} does not
+        program.addJump(_bTypeAll ? onTrue : onFalse);
+
+        return;
+    }
+
+    for (uiChild = 0; uiChild < uiNbChildren; uiChild++) {
+
+        const CRule *pRule = static_cast<const CRule *>(getChild(uiChild));
+
+        if (uiChild == uiNbChildren - 1) {
+
+            // Last child decides
+            pRule->compile(program, onTrue, onFalse);
+
+            break;
+        }
+        // Otherwise, short-circuit on the first matching child of an Any rule and on the first
+        // non matching child of an All rule
+        size_t next = program.createLabel();
+
+        if (_bTypeAll) {
+
+            pRule->compile(program, next, onFalse);
+        } else {
+
+            pRule->compile(program, onTrue, next);
+        }
+        program.bindLabel(next);
+    }
+}
+
 // From IXmlSink
 bool CCompoundRule::fromXml(const CXmlElement &xmlElement,
                             CXmlSerializingContext &serializingContext)
@@ -147,3 +204,57 @@ void CCompoundRule::toXml(CXmlElement &xmlElement, CXmlSerializingContext &seria
     // Base
     base::toXml(xmlElement, serializingContext);
 }
+
+// Domains bundle serialization
+void CCompoundRule::toBundle(CDomainsBundleWriter &writer) const
+{
+    writer.write(domainsBundle::ECompoundRule);
+    writer.write(static_cast<uint8_t>(_bTypeAll));
+    writer.write(static_cast<uint32_t>(getNbChildren()));
+
+    for (size_t child = 0; child < getNbChildren(); child++) {
+
+        static_cast<const CRule *>(getChild(child))->toBundle(writer);
+    }
+}
+
+bool CCompoundRule::fromBundle(CDomainsBundleReader &reader)
+{
+    uint8_t typeAll;
+    uint32_t nbChildren;
+
+    if (!reader.read(typeAll) || !reader.read(nbChildren)) {
+
+        return false;
+    }
+    _bTypeAll = typeAll != 0;
+
+    for (uint32_t child = 0; child < nbChildren; child++) {
+
+        uint8_t kind;
+
+        if (!reader.read(kind)) {
+
+            return false;
+        }
+        CRule *pRule;
+
+        switch (kind) {
+        case domainsBundle::ECompoundRule:
+            pRule = new CCompoundRule;
+            break;
+        case domainsBundle::ESelectionCriterionRule:
+            pRule = new CSelectionCriterionRule;
+            break;
+        default:
+            return reader.fail("Invalid rule kind in domains bundle");
+        }
+        addChild(pRule);
+
+        if (!pRule->fromBundle(reader)) {
+
+            return false;
+        }
+    }
+    return true;
+}
@@ -45,6 +45,12 @@ public:
     // Rule check
     bool matches() const override;
 
+    // Criteria dependencies
+    void gatherCriteria(std::set<const CSelectionCriterion *> &criteria) const override;
+
+    // Rule compilation
+    void compile(CRuleProgram &program, size_t onTrue, size_t onFalse) const override;
+
     // From IXmlSink
     bool fromXml(const CXmlElement &xmlElement,
                  CXmlSerializingContext &serializingContext) override;
@@ -52,6 +58,10 @@ public:
     // From IXmlSource
     void toXml(CXmlElement &xmlElement, CXmlSerializingContext &serializingContext) const override;
 
+    // Domains bundle serialization
+    void toBundle(CDomainsBundleWriter &writer) const override;
+    bool fromBundle(CDomainsBundleReader &reader) override;
+
     // Class kind
     std::string getKind() const override;
 
@@ -34,6 +34,9 @@
 #include "XmlDomainSerializingContext.h"
 #include "XmlDomainImportContext.h"
 #include "XmlDomainExportContext.h"
+#include "SelectionCriterion.h"
+#include "DomainsBundle.h"
+#include "LazySettingsCache.h"
 #include "Utility.h"
 #include "AlwaysAssert.hpp"
 #include <cassert>
@@ -219,6 +222,9 @@ bool CConfigurableDomain::fromXml(const CXmlElement &xmlElement,
     xmlElement.getAttribute("Name", name);
     setName(name);
 
+    // Configurations and rules are about to change
+    invalidateDecisionCache();
+
     // Local parsing. Do not dig
     if (!parseDomainConfigurations(xmlElement, xmlDomainImportContext) ||
         !parseConfigurableElements(xmlElement, xmlDomainImportContext) ||
@@ -238,6 +244,129 @@ bool CConfigurableDomain::fromXml(const CXmlElement &xmlElement,
     return true;
 }
 
+// Domains bundle serialization
+void CConfigurableDomain::toBundle(CDomainsBundleWriter &writer) const
+{
+    writer.writeString(getName());
+    writer.write(static_cast<uint8_t>(_bSequenceAware));
+
+    // Configurations and their rules
+    size_t uiNbConfigurations = getNbChildren();
+    size_t uiChild;
+
+    writer.write(static_cast<uint32_t>(uiNbConfigurations));
+
+    for (uiChild = 0; uiChild < uiNbConfigurations; uiChild++) {
+
+        const CDomainConfiguration *pDomainConfiguration =
+            static_cast<const CDomainConfiguration *>(getChild(uiChild));
+
+        writer.writeString(pDomainConfiguration->getName());
+        pDomainConfiguration->toBundle(writer);
+    }
+
+    // Configurable elements
+    writer.write(static_cast<uint32_t>(_configurableElementList.size()));
+
+    for (const CConfigurableElement *pConfigurableElement : _configurableElementList) {
+
+        writer.write(writer.getElementIndex(pConfigurableElement));
+        writer.write(static_cast<uint64_t>(pConfigurableElement->getOffset()));
+        writer.write(static_cast<uint64_t>(pConfigurableElement->getFootPrint()));
+    }
+
+    // Settings
+    for (uiChild = 0; uiChild < uiNbConfigurations; uiChild++) {
+
+        static_cast<const CDomainConfiguration *>(getChild(uiChild))->settingsToBundle(writer);
+    }
+}
+
+bool CConfigurableDomain::fromBundle(CDomainsBundleReader &reader)
+{
+    // We're supposedly clean
+    assert(_configurableElementList.empty());
+
+    uint8_t sequenceAware;
+    uint32_t nbConfigurations;
+
+    if (!reader.read(sequenceAware) || !reader.read(nbConfigurations)) {
+
+        return false;
+    }
+    _bSequenceAware = sequenceAware != 0;
+
+    // Configurations and rules are about to change
+    invalidateDecisionCache();
+
+    uint32_t configuration;
+
+    for (configuration = 0; configuration < nbConfigurations; configuration++) {
+
+        string strName;
+
+        if (!reader.readString(strName)) {
+
+            return false;
+        }
+        CDomainConfiguration *pDomainConfiguration = new CDomainConfiguration(strName);
+
+        addChild(pDomainConfiguration);
+
+        if (!pDomainConfiguration->fromBundle(reader)) {
+
+            return false;
+        }
+    }
+
+    // Configurable elements
+    uint32_t nbConfigurableElements;
+
+    if (!reader.read(nbConfigurableElements)) {
+
+        return false;
+    }
+    for (uint32_t element = 0; element < nbConfigurableElements; element++) {
+
+        CConfigurableElement *pConfigurableElement = reader.readElement();
+        uint64_t offset;
+        uint64_t footPrint;
+
+        if (pConfigurableElement == nullptr || !reader.read(offset) || !reader.read(footPrint)) {
+
+            return false;
+        }
+        if (offset != pConfigurableElement->getOffset() ||
+            footPrint != pConfigurableElement->getFootPrint()) {
+
+            return reader.fail("Configurable element " + pConfigurableElement->getPath() +
+                               " of domain " + getName() + " does not match the domains bundle");
+        }
+        core::Results infos;
+        if (!addConfigurableElement(pConfigurableElement, nullptr, infos)) {
+
+            return reader.fail(utility::asString(infos));
+        }
+    }
+
+    // Settings, with a cache shared by the configurations if lazy
+    std::shared_ptr<CLazySettingsCache> lazySettingsCache;
+
+    if (reader.getLazyBundle() != nullptr && reader.getLazySettingsCacheSize() != 0) {
+
+        lazySettingsCache = std::make_shared<CLazySettingsCache>(reader.getLazySettingsCacheSize());
+    }
+    for (configuration = 0; configuration < nbConfigurations; configuration++) {
+
+        if (!static_cast<CDomainConfiguration *>(getChild(configuration))
+                 ->settingsFromBundle(reader, lazySettingsCache)) {
+
+            return false;
+        }
+    }
+    return true;
+}
+
 // XML parsing
 bool CConfigurableDomain::parseDomainConfigurations(const CXmlElement &xmlElement,
                                                     CXmlDomainImportContext &serializingContext)
@@ -538,9 +667,16 @@ const CDomainConfiguration *CConfigurableDomain::getPendingConfiguration() const
     return nullptr;
 }
 
+utility::LatencyHistogram &CConfigurableDomain::getApplyLatency() const
+{
+    return _applyLatency;
+}
+
 // Configuration application if required
 void CConfigurableDomain::apply(CParameterBlackboard *pParameterBlackboard, CSyncerSet *pSyncerSet,
-                                bool bForce, std::string &strInfo) const
+                                bool bForce,
+                                const CDomainConfiguration *pApplicableDomainConfiguration,
+                                bool bIsolated, std::string &strInfo) const
 {
     // Apply configuration only if the blackboard will
     // be synchronized either now or by syncerSet.
@@ -553,8 +689,6 @@ void CConfigurableDomain::apply(CParameterBlackboard *pParameterBlackboard, CSyn
         // Force a configuration restore by forgetting about last applied configuration
         _pLastAppliedConfiguration = nullptr;
     }
-    const CDomainConfiguration *pApplicableDomainConfiguration =
-        findApplicableDomainConfiguration();
 
     if (pApplicableDomainConfiguration) {
 
@@ -568,18 +702,30 @@ void CConfigurableDomain::apply(CParameterBlackboard *pParameterBlackboard, CSyn
             // Check if we need to synchronize during restore
             bool bSync = !pSyncerSet && _bSequenceAware;
 
-            // Do the restore
-            pApplicableDomainConfiguration->restore(pParameterBlackboard, bSync, nullptr);
+            if (pSyncerSet && !_bSequenceAware && _pLastAppliedConfiguration &&
+                _bLastAppliedIntact) {
 
-            // Record last applied configuration
-            _pLastAppliedConfiguration = pApplicableDomainConfiguration;
+                // Only restore and synchronize what differs from the last applied configuration
+                pApplicableDomainConfiguration->restoreDelta(
+                    pParameterBlackboard, *_pLastAppliedConfiguration, *pSyncerSet);
+            } else {
 
-            // Check we need to provide syncer set to caller
-            if (pSyncerSet && !_bSequenceAware) {
+                // Do the restore
+                pApplicableDomainConfiguration->restore(pParameterBlackboard, bSync, nullptr);
 
-                // Since we applied changes, add our own sync set to the given one
-                *pSyncerSet += _syncerSet;
+                // Check we need to provide syncer set to caller
+                if (pSyncerSet && !_bSequenceAware) {
+
+                    // Since we applied changes, add our own sync set to the given one
+                    *pSyncerSet += _syncerSet;
+                }
             }
+
+            // Record last applied configuration
+            _pLastAppliedConfiguration = pApplicableDomainConfiguration;
+
+            // Other domains do not overwrite it when isolated
+            _bLastAppliedIntact = bIsolated;
         }
     }
 }
@@ -647,6 +793,8 @@ bool CConfigurableDomain::createConfiguration(const string &strName,
     // Hierarchy
     addChild(pDomainConfiguration);
 
+    invalidateDecisionCache();
+
     // Ensure validity of fresh new domain configuration
     // Attempt auto validation, so that the user gets his/her own settings by defaults
     if (!autoValidateConfiguration(pDomainConfiguration)) {
@@ -681,6 +829,9 @@ bool CConfigurableDomain::deleteConfiguration(const string &strName, string &str
     // Destroy
     delete pDomainConfiguration;
 
+    invalidateDecisionCache();
+    invalidateRestoreDeltas();
+
     return true;
 }
 
@@ -730,6 +881,7 @@ bool CConfigurableDomain::restoreConfiguration(const string &configurationName,
 
     // Record last applied configuration
     _pLastAppliedConfiguration = configuration;
+    _bLastAppliedIntact = false;
 
     // Synchronize
     if (autoSync && !_bSequenceAware) {
@@ -770,7 +922,14 @@ bool CConfigurableDomain::setElementSequence(const string &strConfiguration,
     }
 
     // Delegate to configuration
-    return pDomainConfiguration->setElementSequence(astrNewElementSequence, strError);
+    if (!pDomainConfiguration->setElementSequence(astrNewElementSequence, strError)) {
+
+        return false;
+    }
+    // Areas order changed
+    invalidateRestoreDeltas();
+
+    return true;
 }
 
 bool CConfigurableDomain::getElementSequence(const string &strConfiguration,
@@ -803,6 +962,8 @@ bool CConfigurableDomain::setApplicationRule(
         return false;
     }
 
+    invalidateDecisionCache();
+
     // Delegate to configuration
     return pDomainConfiguration->setApplicationRule(strApplicationRule,
                                                     pSelectionCriteriaDefinition, strError);
@@ -821,6 +982,8 @@ bool CConfigurableDomain::clearApplicationRule(const string &strConfiguration, s
     // Delegate to configuration
     pDomainConfiguration->clearApplicationRule();
 
+    invalidateDecisionCache();
+
     return true;
 }
 
@@ -999,6 +1162,54 @@ const CDomainConfiguration *CConfigurableDomain::findValidDomainConfiguration(
 
 // Search for an applicable configuration
 const CDomainConfiguration *CConfigurableDomain::findApplicableDomainConfiguration() const
+{
+    if (!_bDecisionCacheEnabled) {
+
+        return evaluateApplicableDomainConfiguration();
+    }
+
+    if (!_bDecisionCacheValid) {
+
+        // Rules changed, collect the criteria they now depend on
+        std::set<const CSelectionCriterion *> criteria;
+        gatherCriteria(criteria);
+
+        _decisionCriteria.assign(criteria.begin(), criteria.end());
+        _decisionCache.clear();
+        _bDecisionCacheValid = true;
+    }
+
+    // Build key out of the criteria states
+    _decisionKey.resize(_decisionCriteria.size());
+
+    for (size_t index = 0; index < _decisionCriteria.size(); index++) {
+
+        _decisionKey[index] = _decisionCriteria[index]->getCriterionState();
+    }
+
+    auto it = _decisionCache.find(_decisionKey);
+
+    if (it != _decisionCache.end()) {
+
+        _uiDecisionCacheHits++;
+
+        return it->second;
+    }
+    _uiDecisionCacheMisses++;
+
+    const CDomainConfiguration *pApplicableDomainConfiguration =
+        evaluateApplicableDomainConfiguration();
+
+    if (_decisionCache.size() >= _decisionCacheCapacity) {
+
+        _decisionCache.clear();
+    }
+    _decisionCache.emplace(_decisionKey, pApplicableDomainConfiguration);
+
+    return pApplicableDomainConfiguration;
+}
+
+const CDomainConfiguration *CConfigurableDomain::evaluateApplicableDomainConfiguration() const
 {
     size_t uiNbConfigurations = getNbChildren();
 
@@ -1015,6 +1226,55 @@ const CDomainConfiguration *CConfigurableDomain::findApplicableDomainConfigurati
     return nullptr;
 }
 
+// Decision cache
+void CConfigurableDomain::setDecisionCacheEnabled(bool bEnabled)
+{
+    _bDecisionCacheEnabled = bEnabled;
+
+    invalidateDecisionCache();
+}
+
+string CConfigurableDomain::getDecisionCacheStatistics() const
+{
+    return std::to_string(_uiDecisionCacheHits) + " hits, " +
+           std::to_string(_uiDecisionCacheMisses) + " misses, " +
+           std::to_string(_decisionCache.size()) + " cached decisions";
+}
+
+void CConfigurableDomain::invalidateDecisionCache() const
+{
+    _bDecisionCacheValid = false;
+    _decisionCache.clear();
+}
+
+void CConfigurableDomain::setLastAppliedAltered() const
+{
+    _bLastAppliedIntact = false;
+}
+
+void CConfigurableDomain::invalidateRestoreDeltas()
+{
+    _bLastAppliedIntact = false;
+
+    size_t uiNbConfigurations = getNbChildren();
+
+    for (size_t uiChild = 0; uiChild < uiNbConfigurations; uiChild++) {
+
+        static_cast<CDomainConfiguration *>(getChild(uiChild))->clearDeltas();
+    }
+}
+
+size_t CConfigurableDomain::DecisionKeyHash::operator()(const DecisionKey &key) const
+{
+    size_t hash = key.size();
+
+    for (int state : key) {
+
+        hash ^= std::hash<int>()(state) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
+
 // Gather set of configurable elements
 void CConfigurableDomain::gatherConfigurableElements(
     std::set<const CConfigurableElement *> &configurableElementSet) const
@@ -1023,6 +1283,20 @@ void CConfigurableDomain::gatherConfigurableElements(
     configurableElementSet.insert(_configurableElementList.begin(), _configurableElementList.end());
 }
 
+// Gather set of selection criteria the configurations depend on
+void CConfigurableDomain::gatherCriteria(std::set<const CSelectionCriterion *> &criteria) const
+{
+    size_t uiNbConfigurations = getNbChildren();
+
+    for (size_t uiChild = 0; uiChild < uiNbConfigurations; uiChild++) {
+
+        const CDomainConfiguration *pDomainConfiguration =
+            static_cast<const CDomainConfiguration *>(getChild(uiChild));
+
+        pDomainConfiguration->gatherCriteria(criteria);
+    }
+}
+
 // Check configurable element already attached
 bool CConfigurableDomain::containsConfigurableElement(
     const CConfigurableElement *pConfigurableCandidateElement) const
@@ -1143,6 +1417,8 @@ void CConfigurableDomain::doAddConfigurableElement(CConfigurableElement *pConfig
 
     // Add to list
     _configurableElementList.push_back(pConfigurableElement);
+
+    invalidateRestoreDeltas();
 }
 
 void CConfigurableDomain::doRemoveConfigurableElement(CConfigurableElement *pConfigurableElement,
@@ -1176,6 +1452,7 @@ void CConfigurableDomain::doRemoveConfigurableElement(CConfigurableElement *pCon
 
         computeSyncSet();
     }
+    invalidateRestoreDeltas();
 }
 
 // Syncer set retrieval from configurable element
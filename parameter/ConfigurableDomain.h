@@ -34,15 +34,21 @@
 #include "XmlDomainExportContext.h"
 #include "SyncerSet.h"
 #include "Results.h"
+#include "LatencyHistogram.hpp"
 #include <list>
 #include <set>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 class CConfigurableElement;
 class CDomainConfiguration;
 class CParameterBlackboard;
 class CSelectionCriteriaDefinition;
+class CSelectionCriterion;
+class CDomainsBundleWriter;
+class CDomainsBundleReader;
 
 class CConfigurableDomain : public CElement
 {
@@ -91,6 +97,19 @@ public:
     bool clearApplicationRule(const std::string &strConfiguration, std::string &strError);
     bool getApplicationRule(const std::string &strConfiguration, std::string &strResult) const;
 
+    /** Enable or disable the decision cache
+     *
+     * When enabled, the configuration found applicable is memoized for each combination of the
+     * states of the criteria the domain rules depend on.
+     */
+    void setDecisionCacheEnabled(bool bEnabled);
+
+    // Decision cache hit/miss counters
+    std::string getDecisionCacheStatistics() const;
+
+    /** @return the latencies of the configuration applications of the domain */
+    utility::LatencyHistogram &getApplyLatency() const;
+
     // Last applied configuration name
     std::string getLastAppliedConfigurationName() const;
 
@@ -102,6 +121,9 @@ public:
         std::set<const CConfigurableElement *> &configurableElementSet) const;
     void listAssociatedToElements(std::string &strResult) const;
 
+    // Selection criteria referenced by the application rules of the configurations
+    void gatherCriteria(std::set<const CSelectionCriterion *> &criteria) const;
+
     /** Add a configurable element to the domain
      *
      * @param[in] pConfigurableElement pointer to the element to add
@@ -132,16 +154,30 @@ public:
     // Ensure validity on whole domain from main blackboard
     void validate(const CParameterBlackboard *pMainBlackboard);
 
+    // Search for an applicable configuration
+    const CDomainConfiguration *findApplicableDomainConfiguration() const;
+
     /** Apply the configuration if required
      *
      * @param[in] pParameterBlackboard the blackboard to synchronize
      * @param[in] pSyncerSet pointer to the set containing application syncers
      * @param[in] bForced boolean used to force configuration application
+     * @param[in] pApplicableDomainConfiguration the applicable configuration, as found by
+     *            findApplicableDomainConfiguration (or an equivalent evaluation), may be null
+     * @param[in] bIsolated true if no other domain writes to the blackboard area of this domain,
+     *            allowing later applications to only restore what differs from this one
      * @param[out] info string containing useful information we can provide to client
      */
     void apply(CParameterBlackboard *pParameterBlackboard, CSyncerSet *pSyncerSet, bool bForced,
+               const CDomainConfiguration *pApplicableDomainConfiguration, bool bIsolated,
                std::string &info) const;
 
+    /** Notify the main blackboard was modified outside of configuration application
+     *
+     * The next application then restores whole configurations again.
+     */
+    void setLastAppliedAltered() const;
+
     // Return applicable configuration validity for given configurable element
     bool isApplicableConfigurationValid(const CConfigurableElement *pConfigurableElement) const;
 
@@ -154,6 +190,17 @@ public:
     void childrenToXml(CXmlElement &xmlElement,
                        CXmlSerializingContext &serializingContext) const override;
 
+    /** Domains bundle serialization
+     *
+     * Configurable elements are referred to by their index in the structure. Their offset and
+     * footprint are serialized as well so that a stale bundle is detected even on a structure
+     * hash collision.
+     * @{
+     */
+    void toBundle(CDomainsBundleWriter &writer) const;
+    bool fromBundle(CDomainsBundleReader &reader);
+    /** @} */
+
     // Class kind
     std::string getKind() const override;
 
@@ -165,8 +212,14 @@ private:
     // Get pending configuration
     const CDomainConfiguration *getPendingConfiguration() const;
 
-    // Search for an applicable configuration
-    const CDomainConfiguration *findApplicableDomainConfiguration() const;
+    // Search for an applicable configuration by evaluating the rules of every configuration
+    const CDomainConfiguration *evaluateApplicableDomainConfiguration() const;
+
+    // To be called whenever configurations or their rules change
+    void invalidateDecisionCache() const;
+
+    // To be called whenever configurations or elements change
+    void invalidateRestoreDeltas();
 
     // Returns true if children dynamic creation is to be dealt with (here, will allow child
     // deletion upon clean)
@@ -287,4 +340,39 @@ private:
 
     // Last applied configuration
     mutable const CDomainConfiguration *_pLastAppliedConfiguration{nullptr};
+
+    // Does the main blackboard still hold the last applied configuration
+    mutable bool _bLastAppliedIntact{false};
+
+    /// Decision cache
+    using DecisionKey = std::vector<int>;
+
+    struct DecisionKeyHash
+    {
+        size_t operator()(const DecisionKey &key) const;
+    };
+
+    bool _bDecisionCacheEnabled{false};
+
+    // Whether the criteria list and cached decisions reflect the current rules
+    mutable bool _bDecisionCacheValid{false};
+
+    // Criteria the rules depend on, whose states make up the cache key
+    mutable std::vector<const CSelectionCriterion *> _decisionCriteria;
+
+    // Criteria states to applicable configuration (which may be none)
+    mutable std::unordered_map<DecisionKey, const CDomainConfiguration *, DecisionKeyHash>
+        _decisionCache;
+
+    // Key scratch buffer, avoids an allocation per lookup
+    mutable DecisionKey _decisionKey;
+
+    mutable uint64_t _uiDecisionCacheHits{0};
+    mutable uint64_t _uiDecisionCacheMisses{0};
+
+    // Cached decisions are dropped when reaching this count, bounding memory usage
+    static const size_t _decisionCacheCapacity = 4096;
+
+    // Configuration application latencies, recorded by the domains container
+    mutable utility::LatencyHistogram _applyLatency;
 };
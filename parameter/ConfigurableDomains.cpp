@@ -30,7 +30,15 @@
 #include <cassert>
 #include "ConfigurableDomains.h"
 #include "ConfigurableDomain.h"
+#include "DomainConfiguration.h"
 #include "ConfigurableElement.h"
+#include "SelectionCriterion.h"
+#include "ParameterBlackboard.h"
+#include "SyncerSet.h"
+#include "ThreadPool.hpp"
+#include "ApplyReport.h"
+#include "DomainsBundle.h"
+#include <algorithm>
 
 #define base CElement
 
@@ -62,43 +70,400 @@ void CConfigurableDomains::validate(const CParameterBlackboard *pMainBlackboard)
 }
 
 // Configuration application if required
-void CConfigurableDomains::apply(CParameterBlackboard *pParameterBlackboard, CSyncerSet &syncerSet,
-                                 bool bForce, core::Results &infos) const
+bool CConfigurableDomains::apply(CParameterBlackboard *pParameterBlackboard, CSyncerSet &syncerSet,
+                                 bool bForce, core::Results &infos, ApplyReport *pReport) const
 {
+    // Only consider domains which may have a new applicable configuration
+    std::vector<size_t> domainIndexes;
+    gatherDomainsToApply(bForce, domainIndexes);
+
+    // No criterion changed: applied configurations stand, only resynchronize subsystems if needed
+    if (domainIndexes.empty()) {
+
+        if (!syncerSet.empty()) {
+
+            syncerSet.sync(*pParameterBlackboard, false,
+                           pReport != nullptr ? &pReport->syncErrors : nullptr, _pSyncThreadPool);
+        }
+        return false;
+    }
+
+    // Parameters were written since last application: domains areas may not hold their last
+    // applied configuration anymore
+    if (pParameterBlackboard->getGeneration() != _uiAppliedBlackboardGeneration) {
+
+        size_t uiNbConfigurableDomains = getNbChildren();
+
+        for (size_t child = 0; child < uiNbConfigurableDomains; child++) {
+
+            static_cast<const CConfigurableDomain *>(getChild(child))->setLastAppliedAltered();
+        }
+    }
+
+    size_t uiNbDomainsToApply = domainIndexes.size();
+
+    // Their applicable configuration is found once for both passes
+    std::vector<const CDomainConfiguration *> applicableConfigurations(uiNbDomainsToApply);
+
+    // Rule groups match domain indexes
+    if (!_bDecisionCacheEnabled) {
+
+        _ruleBatch.evaluate(domainIndexes);
+    }
+
     /// Delegate to domains
 
-    // Start with domains that can be synchronized all at once (with passed syncer set)
-    size_t uiNbConfigurableDomains = getNbChildren();
+    // Start with domains that can be synchronized all at once (with passed syncer set).
+    // Syncers and infos are collected per domain, then merged in domain order.
+    std::vector<CSyncerSet> domainSyncerSets(uiNbDomainsToApply);
+    std::vector<std::string> domainInfos(uiNbDomainsToApply);
+
+    // A domain provides an info only when it restored a configuration, which is what is timed
+    using Clock = utility::LatencyHistogram::Clock;
+    auto startLatency = [&] {
+        return _bApplyLatencyRecorded ? Clock::now() : Clock::time_point();
+    };
+    auto recordLatency = [&](const CConfigurableDomain *pDomain, Clock::time_point start,
+                             const std::string &info) {
+        if (_bApplyLatencyRecorded && !info.empty()) {
+            pDomain->getApplyLatency().record(Clock::now() - start);
+        }
+    };
 
-    for (size_t child = 0; child < uiNbConfigurableDomains; child++) {
+    auto applyDomain = [&](size_t index) {
+        size_t child = domainIndexes[index];
 
         const CConfigurableDomain *pChildConfigurableDomain =
             static_cast<const CConfigurableDomain *>(getChild(child));
 
-        std::string info;
+        applicableConfigurations[index] = findApplicableConfiguration(child);
+
+        auto start = startLatency();
+
         // Apply and collect syncers when relevant
-        pChildConfigurableDomain->apply(pParameterBlackboard, &syncerSet, bForce, info);
+        pChildConfigurableDomain->apply(pParameterBlackboard, &domainSyncerSets[index], bForce,
+                                        applicableConfigurations[index], _isolatedDomains[child],
+                                        domainInfos[index]);
+        recordLatency(pChildConfigurableDomain, start, domainInfos[index]);
+    };
 
-        if (!info.empty()) {
-            infos.push_back(info);
+    if (_pThreadPool != nullptr) {
+
+        // Isolated domains write to their own blackboard area only, so they may be applied in
+        // any order. The others are applied afterwards, in order, as they would serially.
+        std::vector<size_t> isolatedIndexes;
+        std::vector<size_t> sharingIndexes;
+
+        for (size_t index = 0; index < uiNbDomainsToApply; index++) {
+
+            if (_isolatedDomains[domainIndexes[index]]) {
+
+                isolatedIndexes.push_back(index);
+            } else {
+
+                sharingIndexes.push_back(index);
+            }
+        }
+        _pThreadPool->parallelFor(isolatedIndexes.size(),
+                                  [&](size_t task) { applyDomain(isolatedIndexes[task]); });
+
+        for (size_t index : sharingIndexes) {
+
+            applyDomain(index);
+        }
+    } else {
+
+        for (size_t index = 0; index < uiNbDomainsToApply; index++) {
+
+            applyDomain(index);
+        }
+    }
+
+    // A domain provides an info only when it applied a configuration
+    auto report = [&](size_t index) {
+        if (pReport != nullptr) {
+            pReport->appliedConfigurations.push_back(
+                {getChild(domainIndexes[index])->getName(),
+                 applicableConfigurations[index]->getName()});
+        }
+    };
+
+    for (size_t index = 0; index < uiNbDomainsToApply; index++) {
+
+        syncerSet += domainSyncerSets[index];
+
+        if (!domainInfos[index].empty()) {
+            infos.push_back(domainInfos[index]);
+            report(index);
         }
     }
     // Synchronize those collected syncers
-    syncerSet.sync(*pParameterBlackboard, false, nullptr);
+    syncerSet.sync(*pParameterBlackboard, false,
+                   pReport != nullptr ? &pReport->syncErrors : nullptr, _pSyncThreadPool);
 
     // Then deal with domains that need to synchronize along apply
-    for (size_t child = 0; child < uiNbConfigurableDomains; child++) {
+    for (size_t index = 0; index < uiNbDomainsToApply; index++) {
 
         const CConfigurableDomain *pChildConfigurableDomain =
-            static_cast<const CConfigurableDomain *>(getChild(child));
+            static_cast<const CConfigurableDomain *>(getChild(domainIndexes[index]));
 
         std::string info;
+        auto start = startLatency();
+
         // Apply and synchronize when relevant
-        pChildConfigurableDomain->apply(pParameterBlackboard, nullptr, bForce, info);
+        pChildConfigurableDomain->apply(pParameterBlackboard, nullptr, bForce,
+                                        applicableConfigurations[index], false, info);
+        recordLatency(pChildConfigurableDomain, start, info);
         if (!info.empty()) {
             infos.push_back(info);
+            report(index);
+        }
+    }
+    _uiAppliedBlackboardGeneration = pParameterBlackboard->getGeneration();
+    return true;
+}
+
+const CDomainConfiguration *CConfigurableDomains::findApplicableConfiguration(size_t child) const
+{
+    const CConfigurableDomain *pChildConfigurableDomain =
+        static_cast<const CConfigurableDomain *>(getChild(child));
+
+    if (_bDecisionCacheEnabled) {
+
+        // Let the domain look its decision cache up
+        return pChildConfigurableDomain->findApplicableDomainConfiguration();
+    }
+
+    // Batch evaluation, rule groups matching domain indexes
+    size_t configuration = _ruleBatch.findFirstMatch(child);
+
+    return configuration < pChildConfigurableDomain->getNbChildren()
+               ? static_cast<const CDomainConfiguration *>(
+                     pChildConfigurableDomain->getChild(configuration))
+               : nullptr;
+}
+
+void CConfigurableDomains::gatherDomainsToApply(bool bForce,
+                                                std::vector<size_t> &domainIndexes) const
+{
+    size_t uiNbConfigurableDomains = getNbChildren();
+
+    // Domains, configurations or rules changed since last application: visit everything
+    if (!_bCriterionIndexValid) {
+
+        buildCriterionIndex();
+        buildRuleBatch();
+        buildIsolatedDomains();
+
+        bForce = true;
+    }
+
+    if (bForce) {
+
+        for (size_t child = 0; child < uiNbConfigurableDomains; child++) {
+
+            domainIndexes.push_back(child);
+        }
+        return;
+    }
+
+    // Only domains depending on a modified criterion may have a different applicable
+    // configuration. Keep the domain order for a deterministic application.
+    std::set<size_t> domainIndexSet;
+
+    for (const auto &criterionDomains : _criterionToDomainsIndex) {
+
+        if (criterionDomains.first->hasBeenModified()) {
+
+            domainIndexSet.insert(criterionDomains.second.begin(), criterionDomains.second.end());
+        }
+    }
+    domainIndexes.assign(domainIndexSet.begin(), domainIndexSet.end());
+}
+
+void CConfigurableDomains::buildCriterionIndex() const
+{
+    _criterionToDomainsIndex.clear();
+
+    size_t uiNbConfigurableDomains = getNbChildren();
+
+    for (size_t child = 0; child < uiNbConfigurableDomains; child++) {
+
+        const CConfigurableDomain *pChildConfigurableDomain =
+            static_cast<const CConfigurableDomain *>(getChild(child));
+
+        std::set<const CSelectionCriterion *> criteria;
+        pChildConfigurableDomain->gatherCriteria(criteria);
+
+        for (const CSelectionCriterion *pCriterion : criteria) {
+
+            _criterionToDomainsIndex[pCriterion].push_back(child);
+        }
+    }
+    _bCriterionIndexValid = true;
+}
+
+void CConfigurableDomains::buildRuleBatch() const
+{
+    _ruleBatch.clear();
+
+    size_t uiNbConfigurableDomains = getNbChildren();
+
+    for (size_t child = 0; child < uiNbConfigurableDomains; child++) {
+
+        const CConfigurableDomain *pChildConfigurableDomain =
+            static_cast<const CConfigurableDomain *>(getChild(child));
+
+        // One group per domain, holding its configuration rules in order
+        _ruleBatch.beginGroup();
+
+        size_t uiNbConfigurations = pChildConfigurableDomain->getNbChildren();
+
+        for (size_t configuration = 0; configuration < uiNbConfigurations; configuration++) {
+
+            const CDomainConfiguration *pDomainConfiguration =
+                static_cast<const CDomainConfiguration *>(
+                    pChildConfigurableDomain->getChild(configuration));
+
+            _ruleBatch.addProgram(pDomainConfiguration->getRuleProgram());
+        }
+    }
+}
+
+void CConfigurableDomains::buildIsolatedDomains() const
+{
+    // Blackboard area of a domain element
+    struct Area
+    {
+        size_t begin;
+        size_t end;
+        size_t domain;
+    };
+    std::vector<Area> areas;
+
+    size_t uiNbConfigurableDomains = getNbChildren();
+
+    _isolatedDomains.assign(uiNbConfigurableDomains, true);
+
+    for (size_t child = 0; child < uiNbConfigurableDomains; child++) {
+
+        const CConfigurableDomain *pChildConfigurableDomain =
+            static_cast<const CConfigurableDomain *>(getChild(child));
+
+        std::set<const CConfigurableElement *> configurableElements;
+        pChildConfigurableDomain->gatherConfigurableElements(configurableElements);
+
+        for (const CConfigurableElement *pConfigurableElement : configurableElements) {
+
+            if (pConfigurableElement->getFootPrint() == 0) {
+
+                // Bit parameters are read-modified-written within the block of their parent
+                pConfigurableElement =
+                    static_cast<const CConfigurableElement *>(pConfigurableElement->getParent());
+            }
+            size_t offset = pConfigurableElement->getOffset();
+
+            areas.push_back({offset, offset + pConfigurableElement->getFootPrint(), child});
         }
     }
+    // Domains owning overlapping areas are not isolated
+    std::sort(areas.begin(), areas.end(),
+              [](const Area &lhs, const Area &rhs) { return lhs.begin < rhs.begin; });
+
+    for (size_t area = 0; area < areas.size(); area++) {
+
+        for (size_t next = area + 1; next < areas.size() && areas[next].begin < areas[area].end;
+             next++) {
+
+            if (areas[next].domain != areas[area].domain) {
+
+                _isolatedDomains[areas[area].domain] = false;
+                _isolatedDomains[areas[next].domain] = false;
+            }
+        }
+    }
+}
+
+void CConfigurableDomains::setThreadPool(utility::ThreadPool *pThreadPool)
+{
+    _pThreadPool = pThreadPool;
+}
+
+void CConfigurableDomains::setSyncThreadPool(utility::ThreadPool *pThreadPool)
+{
+    _pSyncThreadPool = pThreadPool;
+}
+
+void CConfigurableDomains::invalidateCriterionIndex() const
+{
+    _bCriterionIndexValid = false;
+}
+
+void CConfigurableDomains::clean()
+{
+    invalidateCriterionIndex();
+
+    base::clean();
+}
+
+// From IXmlSink
+bool CConfigurableDomains::fromXml(const CXmlElement &xmlElement,
+                                   CXmlSerializingContext &serializingContext)
+{
+    if (!base::fromXml(xmlElement, serializingContext)) {
+
+        return false;
+    }
+    // Propagate decision cache state to the new domains
+    setDecisionCacheEnabled(_bDecisionCacheEnabled);
+
+    return true;
+}
+
+// Domains bundle serialization
+void CConfigurableDomains::toBundle(CDomainsBundleWriter &writer) const
+{
+    size_t uiNbConfigurableDomains = getNbChildren();
+
+    writer.write(static_cast<uint32_t>(uiNbConfigurableDomains));
+
+    for (size_t uiChild = 0; uiChild < uiNbConfigurableDomains; uiChild++) {
+
+        static_cast<const CConfigurableDomain *>(getChild(uiChild))->toBundle(writer);
+    }
+}
+
+bool CConfigurableDomains::fromBundle(CDomainsBundleReader &reader)
+{
+    clean();
+
+    uint32_t nbConfigurableDomains;
+
+    if (!reader.read(nbConfigurableDomains)) {
+
+        return false;
+    }
+    for (uint32_t domain = 0; domain < nbConfigurableDomains; domain++) {
+
+        string strName;
+
+        if (!reader.readString(strName)) {
+
+            return false;
+        }
+        CConfigurableDomain *pConfigurableDomain = new CConfigurableDomain(strName);
+
+        addChild(pConfigurableDomain);
+
+        if (!pConfigurableDomain->fromBundle(reader)) {
+
+            return false;
+        }
+    }
+    // Propagate decision cache state to the new domains
+    setDecisionCacheEnabled(_bDecisionCacheEnabled);
+
+    return true;
 }
 
 // From IXmlSource
@@ -124,7 +489,12 @@ bool CConfigurableDomains::createDomain(const string &strName, string &strError)
     }
 
     // Creation/Hierarchy
-    addChild(new CConfigurableDomain(strName));
+    auto pConfigurableDomain = new CConfigurableDomain(strName);
+    pConfigurableDomain->setDecisionCacheEnabled(_bDecisionCacheEnabled);
+
+    addChild(pConfigurableDomain);
+
+    invalidateCriterionIndex();
 
     return true;
 }
@@ -146,8 +516,12 @@ bool CConfigurableDomains::addDomain(CConfigurableDomain &domain, bool bOverwrit
         deleteDomain(*pExistingDomain);
     }
 
+    domain.setDecisionCacheEnabled(_bDecisionCacheEnabled);
+
     addChild(&domain);
 
+    invalidateCriterionIndex();
+
     return true;
 }
 
@@ -156,6 +530,8 @@ void CConfigurableDomains::deleteDomain(CConfigurableDomain &configurableDomain)
     removeChild(&configurableDomain);
 
     delete &configurableDomain;
+
+    invalidateCriterionIndex();
 }
 
 bool CConfigurableDomains::deleteDomain(const string &strName, string &strError)
@@ -247,6 +623,9 @@ bool CConfigurableDomains::createConfiguration(const string &strDomain,
 
         return false;
     }
+    // Configuration list changes
+    invalidateCriterionIndex();
+
     // Delegate
     return pConfigurableDomain->createConfiguration(strConfiguration, pMainBlackboard, strError);
 }
@@ -261,6 +640,9 @@ bool CConfigurableDomains::deleteConfiguration(const string &strDomain,
 
         return false;
     }
+    // Configuration list changes
+    invalidateCriterionIndex();
+
     // Delegate
     return pConfigurableDomain->deleteConfiguration(strConfiguration, strError);
 }
@@ -312,6 +694,8 @@ bool CConfigurableDomains::split(const string &domainName, CConfigurableElement
     // Delegate
     domain->split(element, infos);
 
+    invalidateCriterionIndex();
+
     return true;
 }
 
@@ -416,6 +800,9 @@ bool CConfigurableDomains::restoreConfiguration(const string &domainName,
         errors.push_back(error);
         return false;
     }
+    // Last applied configuration may not be the applicable one anymore
+    invalidateCriterionIndex();
+
     // Delegate
     return domain->restoreConfiguration(configurationName, mainBlackboard, autoSync, errors);
 }
@@ -481,6 +868,9 @@ bool CConfigurableDomains::setApplicationRule(
         return false;
     }
 
+    // Rule changes
+    invalidateCriterionIndex();
+
     // Delegate to domain
     return pConfigurableDomain->setApplicationRule(strConfiguration, strApplicationRule,
                                                    pSelectionCriteriaDefinition, strError);
@@ -496,6 +886,9 @@ bool CConfigurableDomains::clearApplicationRule(const string &strDomain,
         return false;
     }
 
+    // Rule changes
+    invalidateCriterionIndex();
+
     // Delegate to domain
     return pConfigurableDomain->clearApplicationRule(strConfiguration, strError);
 }
@@ -532,6 +925,47 @@ void CConfigurableDomains::listLastAppliedConfigurations(string &strResult) cons
     }
 }
 
+// Decision cache
+void CConfigurableDomains::setDecisionCacheEnabled(bool bEnabled)
+{
+    _bDecisionCacheEnabled = bEnabled;
+
+    size_t uiNbConfigurableDomains = getNbChildren();
+
+    for (size_t child = 0; child < uiNbConfigurableDomains; child++) {
+
+        CConfigurableDomain *pChildConfigurableDomain =
+            static_cast<CConfigurableDomain *>(getChild(child));
+
+        pChildConfigurableDomain->setDecisionCacheEnabled(bEnabled);
+    }
+}
+
+bool CConfigurableDomains::isDecisionCacheEnabled() const
+{
+    return _bDecisionCacheEnabled;
+}
+
+void CConfigurableDomains::setApplyLatencyRecorded(bool bRecorded)
+{
+    _bApplyLatencyRecorded = bRecorded;
+}
+
+void CConfigurableDomains::listDecisionCacheStatistics(string &strResult) const
+{
+    // Browse domains
+    size_t uiNbConfigurableDomains = getNbChildren();
+
+    for (size_t child = 0; child < uiNbConfigurableDomains; child++) {
+
+        const CConfigurableDomain *pChildConfigurableDomain =
+            static_cast<const CConfigurableDomain *>(getChild(child));
+
+        strResult += pChildConfigurableDomain->getName() + ": " +
+                     pChildConfigurableDomain->getDecisionCacheStatistics() + "\n";
+    }
+}
+
 // Configurable element - domain association
 bool CConfigurableDomains::addConfigurableElementToDomain(
     const string &domainName, CConfigurableElement *element,
@@ -547,7 +981,13 @@ bool CConfigurableDomains::addConfigurableElementToDomain(
         return false;
     }
     // Delegate
-    return domain->addConfigurableElement(element, mainBlackboard, infos);
+    if (!domain->addConfigurableElement(element, mainBlackboard, infos)) {
+
+        return false;
+    }
+    invalidateCriterionIndex();
+
+    return true;
 }
 
 bool CConfigurableDomains::removeConfigurableElementFromDomain(
@@ -561,7 +1001,13 @@ bool CConfigurableDomains::removeConfigurableElementFromDomain(
         return false;
     }
     // Delegate
-    return pConfigurableDomain->removeConfigurableElement(pConfigurableElement, strError);
+    if (!pConfigurableDomain->removeConfigurableElement(pConfigurableElement, strError)) {
+
+        return false;
+    }
+    invalidateCriterionIndex();
+
+    return true;
 }
 
 CParameterBlackboard *CConfigurableDomains::findConfigurationBlackboard(
@@ -31,14 +31,27 @@
 
 #include "Element.h"
 #include "Results.h"
+#include "RuleBatch.h"
+#include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 class CParameterBlackboard;
 class CConfigurableElement;
 class CSyncerSet;
 class CConfigurableDomain;
+class CDomainConfiguration;
 class CSelectionCriteriaDefinition;
+class CSelectionCriterion;
+class CDomainsBundleWriter;
+class CDomainsBundleReader;
+struct ApplyReport;
+
+namespace utility
+{
+class ThreadPool;
+} // namespace utility
 
 class CConfigurableDomains : public CElement
 {
@@ -134,6 +147,38 @@ public:
     // Last applied configurations
     void listLastAppliedConfigurations(std::string &strResult) const;
 
+    /** Enable or disable the decision cache of every domain, including future ones
+     *
+     * @see CConfigurableDomain::setDecisionCacheEnabled
+     */
+    void setDecisionCacheEnabled(bool bEnabled);
+    bool isDecisionCacheEnabled() const;
+    // Decision cache hit/miss counters of each domain
+    void listDecisionCacheStatistics(std::string &strResult) const;
+
+    /** Record or not the configuration application latency of each domain
+     *
+     * Only applications which restore a configuration are recorded.
+     *
+     * @see CConfigurableDomain::getApplyLatency
+     */
+    void setApplyLatencyRecorded(bool bRecorded);
+
+    /** Set the pool used to apply domains concurrently
+     *
+     * Only the domains sharing no blackboard area with other domains are applied concurrently,
+     * the others are still applied one after the other, in order.
+     *
+     * @param[in] pThreadPool the pool, not owned, nullptr to apply domains serially
+     */
+    void setThreadPool(utility::ThreadPool *pThreadPool);
+
+    /** Set the pool used to synchronize subsystems concurrently after application
+     *
+     * @param[in] pThreadPool the pool, not owned, nullptr to synchronize subsystems serially
+     */
+    void setSyncThreadPool(utility::ThreadPool *pThreadPool);
+
     /** Associate a configurable element to a domain
      *
      * @param[in] domainName the domain name
@@ -160,26 +205,79 @@ public:
     const CConfigurableDomain *findConfigurableDomain(const std::string &strDomain,
                                                       std::string &strError) const;
 
+    // From IXmlSink
+    bool fromXml(const CXmlElement &xmlElement,
+                 CXmlSerializingContext &serializingContext) override;
+
     // From IXmlSource
     void toXml(CXmlElement &xmlElement, CXmlSerializingContext &serializingContext) const override;
 
+    /** Domains bundle serialization
+     *
+     * Loading replaces all existing domains.
+     * @{
+     */
+    void toBundle(CDomainsBundleWriter &writer) const;
+    bool fromBundle(CDomainsBundleReader &reader);
+    /** @} */
+
     // Ensure validity on whole domains from main blackboard
     void validate(const CParameterBlackboard *pMainBlackboard);
 
     /** Apply the configuration if required
+     *
+     * Only the domains whose rules reference a modified selection criterion are visited, unless
+     * the application is forced or the domain set changed since the last application.
      *
      * @param[in] pParameterBlackboard the blackboard to synchronize
      * @param[in] syncerSet the set containing application syncers
      * @param[in] bForce boolean used to force configuration application
      * @param[out] infos useful information we can provide to client
+     * @param[out] pReport filled with the applied configurations and sync errors, if not null
+     * @return false if no domain was visited, the blackboard being left as is
      */
-    void apply(CParameterBlackboard *pParameterBlackboard, CSyncerSet &syncerSet, bool bForce,
-               core::Results &infos) const;
+    bool apply(CParameterBlackboard *pParameterBlackboard, CSyncerSet &syncerSet, bool bForce,
+               core::Results &infos, ApplyReport *pReport = nullptr) const;
+
+    // From CElement
+    void clean() override;
 
     // Class kind
     std::string getKind() const override;
 
 private:
+    /** Forget the criterion to domain index, the rule batch and the isolated domains
+     *
+     * To be called whenever domains, configurations, rules or elements change. They are lazily
+     * rebuilt by the next application, which then visits every domain.
+     */
+    void invalidateCriterionIndex() const;
+
+    // Build the criterion to domain index from the domains application rules
+    void buildCriterionIndex() const;
+
+    // Lay out the rules of every domain configuration for batch evaluation
+    void buildRuleBatch() const;
+
+    // Find the domains whose elements share no blackboard area with other domains
+    void buildIsolatedDomains() const;
+
+    /** Find the applicable configuration of a domain
+     *
+     * Batch evaluation requires criteria states to be packed beforehand.
+     *
+     * @param[in] child the index of the domain
+     * @return the applicable configuration of the domain, null if none
+     */
+    const CDomainConfiguration *findApplicableConfiguration(size_t child) const;
+
+    /** Gather the indexes of the domains to visit during application
+     *
+     * @param[in] bForce boolean used to force configuration application
+     * @param[out] domainIndexes ordered indexes of the domains to visit
+     */
+    void gatherDomainsToApply(bool bForce, std::vector<size_t> &domainIndexes) const;
+
     /** Delete a domain
      *
      * @param(in] configurableDomain domain to be deleted
@@ -196,4 +294,26 @@ private:
     // Domain retrieval
     CConfigurableDomain *findConfigurableDomain(const std::string &strDomain,
                                                 std::string &strError);
+
+    // Indexes of the domains whose rules depend on each selection criterion
+    mutable std::map<const CSelectionCriterion *, std::vector<size_t>> _criterionToDomainsIndex;
+
+    // Is the criterion to domain index (and rule batch, isolated domains) up to date
+    mutable bool _bCriterionIndexValid{false};
+
+    // Rules of the configurations of every domain, one group per domain
+    mutable CRuleBatch _ruleBatch;
+    // Domains which may be applied concurrently with others, by domain index
+    mutable std::vector<bool> _isolatedDomains;
+    // Pool to apply isolated domains with, none if null
+    utility::ThreadPool *_pThreadPool{nullptr};
+    // Pool to synchronize subsystems with, none if null
+    utility::ThreadPool *_pSyncThreadPool{nullptr};
+    // Main blackboard generation at the end of the last application
+    mutable uint64_t _uiAppliedBlackboardGeneration{0};
+
+    // Decision cache state of the domains
+    bool _bDecisionCacheEnabled{false};
+    // Are domain application latencies recorded
+    bool _bApplyLatencyRecorded{false};
 };
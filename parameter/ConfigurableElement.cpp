@@ -390,7 +390,7 @@ void CConfigurableElement::fillSyncerSet(CSyncerSet &syncerSet) const
     if (pMineOrAscendantSyncer) {
 
         // Provide found syncer object
-        syncerSet += pMineOrAscendantSyncer;
+        syncerSet.add(pMineOrAscendantSyncer, getBelongingSubsystem());
 
         // Done
         return;
@@ -507,6 +507,23 @@ bool CConfigurableElement::isRogue() const
     return (rogueElementList.size() == 1) && (rogueElementList.front() == this);
 }
 
+bool CConfigurableElement::belongsToNoDomainAscending() const
+{
+    const CElement *pElement = this;
+
+    while (pElement != nullptr && isOfConfigurableElementType(pElement)) {
+
+        auto *pConfigurableElement = static_cast<const CConfigurableElement *>(pElement);
+
+        if (!pConfigurableElement->_configurableDomainList.empty()) {
+
+            return false;
+        }
+        pElement = pElement->getParent();
+    }
+    return true;
+}
+
 // Footprint as string
 std::string CConfigurableElement::getFootprintAsString() const
 {
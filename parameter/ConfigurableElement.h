@@ -96,6 +96,12 @@ public:
      */
     bool isRogue() const;
 
+    /** @return true if neither this element nor its ascendants are associated with a domain
+     *
+     * Same as isRogue for elements without descendants, without building any list.
+     */
+    bool belongsToNoDomainAscending() const;
+
     // Footprint as string
     std::string getFootprintAsString() const;
 
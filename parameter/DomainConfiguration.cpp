@@ -41,6 +41,8 @@
 #include <algorithm>
 #include <numeric>
 #include "RuleParser.h"
+#include "DomainsBundle.h"
+#include "LazySettingsCache.h"
 
 #define base CElement
 
@@ -50,12 +52,35 @@ CDomainConfiguration::CDomainConfiguration(const string &strName) : base(strName
 {
 }
 
+CDomainConfiguration::~CDomainConfiguration()
+{
+    if (mLazySettings != nullptr && mLazySettings->cache != nullptr) {
+
+        mLazySettings->cache->remove(*this);
+    }
+}
+
 // Class kind
 string CDomainConfiguration::getKind() const
 {
     return "Configuration";
 }
 
+// From IXmlSink
+bool CDomainConfiguration::fromXml(const CXmlElement &xmlElement,
+                                   CXmlSerializingContext &serializingContext)
+{
+    // Create the application rule
+    if (!base::fromXml(xmlElement, serializingContext)) {
+
+        return false;
+    }
+    // Compile it
+    mRuleProgram.compile(getRule());
+
+    return true;
+}
+
 // Child dynamic creation
 bool CDomainConfiguration::childrenAreDynamic() const
 {
@@ -66,6 +91,8 @@ bool CDomainConfiguration::childrenAreDynamic() const
 bool CDomainConfiguration::parseSettings(CXmlElement &xmlConfigurationSettingsElement,
                                          CXmlDomainImportContext &context)
 {
+    pinSettings();
+
     // Parse configurable element's configuration settings
     CXmlElement::CChildIterator it(xmlConfigurationSettingsElement);
 
@@ -101,6 +128,7 @@ bool CDomainConfiguration::parseSettings(CXmlElement &xmlConfigurationSettingsEl
         // areaConfiguration is still valid, but now refer to the reorderer list
         insertLocation = std::next(areaConfiguration);
     }
+    mRestorePlan.clear();
     return true;
 }
 
@@ -108,6 +136,8 @@ bool CDomainConfiguration::parseSettings(CXmlElement &xmlConfigurationSettingsEl
 void CDomainConfiguration::composeSettings(CXmlElement &xmlConfigurationSettingsElement,
                                            CXmlDomainExportContext &context) const
 {
+    decodeSettings();
+
     // Go through all are configurations
     for (auto &areaConfiguration : mAreaConfigurationList) {
 
@@ -186,6 +216,131 @@ bool CDomainConfiguration::importOneConfigurableElementSettings(
     return success;
 }
 
+// Domains bundle serialization
+void CDomainConfiguration::toBundle(CDomainsBundleWriter &writer) const
+{
+    const CCompoundRule *pRule = getRule();
+
+    writer.write(static_cast<uint8_t>(pRule != nullptr));
+
+    if (pRule != nullptr) {
+
+        pRule->toBundle(writer);
+    }
+}
+
+bool CDomainConfiguration::fromBundle(CDomainsBundleReader &reader)
+{
+    uint8_t hasRule;
+
+    if (!reader.read(hasRule)) {
+
+        return false;
+    }
+    if (!hasRule) {
+
+        setRule(nullptr);
+        return true;
+    }
+    uint8_t kind;
+
+    if (!reader.read(kind)) {
+
+        return false;
+    }
+    if (kind != domainsBundle::ECompoundRule) {
+
+        return reader.fail("Invalid application rule of configuration " + getPath() +
+                           " in domains bundle");
+    }
+    // Compile the rule once complete only
+    std::unique_ptr<CCompoundRule> rule(new CCompoundRule);
+
+    if (!rule->fromBundle(reader)) {
+
+        return false;
+    }
+    setRule(rule.release());
+    return true;
+}
+
+void CDomainConfiguration::settingsToBundle(CDomainsBundleWriter &writer) const
+{
+    decodeSettings();
+
+    writer.write(static_cast<uint32_t>(mAreaConfigurationList.size()));
+
+    // In sequence order
+    for (auto &areaConfiguration : mAreaConfigurationList) {
+
+        writer.write(writer.getElementIndex(areaConfiguration->getConfigurableElement()));
+        areaConfiguration->toBundle(writer);
+    }
+}
+
+bool CDomainConfiguration::settingsFromBundle(CDomainsBundleReader &reader,
+                                              std::shared_ptr<CLazySettingsCache> lazySettingsCache)
+{
+    pinSettings();
+
+    if (reader.getLazyBundle() != nullptr) {
+
+        mLazySettings.reset(new LazySettings);
+        mLazySettings->bundle = reader.getLazyBundle();
+        mLazySettings->cache = std::move(lazySettingsCache);
+    }
+    uint32_t nbAreas;
+
+    if (!reader.read(nbAreas)) {
+
+        return false;
+    }
+    auto insertLocation = begin(mAreaConfigurationList);
+
+    for (uint32_t area = 0; area < nbAreas; area++) {
+
+        const CConfigurableElement *pConfigurableElement = reader.readElement();
+
+        if (pConfigurableElement == nullptr) {
+
+            return false;
+        }
+        auto areaConfiguration = find_if(begin(mAreaConfigurationList),
+                                         end(mAreaConfigurationList),
+                                         [&](const AreaConfiguration &conf) {
+                                             return conf->getConfigurableElement() ==
+                                                    pConfigurableElement;
+                                         });
+        if (areaConfiguration == end(mAreaConfigurationList)) {
+
+            return reader.fail("Configurable Element " + pConfigurableElement->getPath() +
+                               " referred to by Configuration " + getPath() +
+                               " not associated to Domain");
+        }
+        // Valid settings are left in the bundle if lazy
+        const uint8_t *pLazySettings = nullptr;
+
+        if (!(*areaConfiguration)->fromBundle(
+                reader, mLazySettings != nullptr ? &pLazySettings : nullptr)) {
+
+            return false;
+        }
+        if (pLazySettings != nullptr) {
+
+            mLazySettings->areas.push_back({areaConfiguration->get(), pLazySettings});
+        }
+        // Restore the sequence order, as when parsing XML settings
+        mAreaConfigurationList.splice(insertLocation, mAreaConfigurationList, areaConfiguration);
+        insertLocation = std::next(areaConfiguration);
+    }
+    if (mLazySettings != nullptr && mLazySettings->areas.empty()) {
+
+        mLazySettings.reset();
+    }
+    mRestorePlan.clear();
+    return true;
+}
+
 bool CDomainConfiguration::exportOneConfigurableElementSettings(
     CAreaConfiguration *areaConfiguration, CXmlElement &xmlConfigurableElementSettingsElement,
     CXmlDomainExportContext &context) const
@@ -214,20 +369,28 @@ bool CDomainConfiguration::exportOneConfigurableElementSettings(
 void CDomainConfiguration::addConfigurableElement(const CConfigurableElement *configurableElement,
                                                   const CSyncerSet *syncerSet)
 {
+    pinSettings();
+
     mAreaConfigurationList.emplace_back(configurableElement->createAreaConfiguration(syncerSet));
+    mRestorePlan.clear();
 }
 
 void CDomainConfiguration::removeConfigurableElement(
     const CConfigurableElement *pConfigurableElement)
 {
+    pinSettings();
+
     auto &areaConfigurationToRemove = getAreaConfiguration(pConfigurableElement);
 
     mAreaConfigurationList.remove(areaConfigurationToRemove);
+    mRestorePlan.clear();
 }
 
 bool CDomainConfiguration::setElementSequence(const std::vector<string> &newElementSequence,
                                               string &error)
 {
+    pinSettings();
+
     std::vector<string> elementSequenceSet;
     auto insertLocation = begin(mAreaConfigurationList);
 
@@ -254,6 +417,7 @@ bool CDomainConfiguration::setElementSequence(const std::vector<string> &newElem
         // areaConfiguration is still valid, but now refer to the reorderer list
         insertLocation = std::next(areaConfiguration);
     }
+    mRestorePlan.clear();
     return true;
 }
 
@@ -312,6 +476,8 @@ string CDomainConfiguration::getApplicationRule() const
 CParameterBlackboard *CDomainConfiguration::getBlackboard(
     const CConfigurableElement *pConfigurableElement) const
 {
+    decodeSettings();
+
     const auto &it = find_if(begin(mAreaConfigurationList), end(mAreaConfigurationList),
                              [&](const AreaConfiguration &conf) {
                                  return conf != nullptr &&
@@ -326,6 +492,8 @@ CParameterBlackboard *CDomainConfiguration::getBlackboard(
 // Save data from current
 void CDomainConfiguration::save(const CParameterBlackboard *pMainBlackboard)
 {
+    pinSettings();
+
     // Just propagate to areas
     for (auto &areaConfiguration : mAreaConfigurationList) {
         areaConfiguration->save(pMainBlackboard);
@@ -336,12 +504,145 @@ void CDomainConfiguration::save(const CParameterBlackboard *pMainBlackboard)
 bool CDomainConfiguration::restore(CParameterBlackboard *pMainBlackboard, bool bSync,
                                    core::Results *errors) const
 {
+    decodeSettings();
+
+    if (!bSync) {
+
+        // Areas settings or order changed since built
+        if (!mRestorePlan.isUpToDate()) {
+
+            mRestorePlan.clear();
+
+            for (const auto &areaConfiguration : mAreaConfigurationList) {
+
+                areaConfiguration->addToRestorePlan(mRestorePlan);
+            }
+        }
+        mRestorePlan.execute(*pMainBlackboard);
+
+        return true;
+    }
+    // Areas are synchronized one after the other
     return std::accumulate(begin(mAreaConfigurationList), end(mAreaConfigurationList), true,
                            [&](bool accumulator, const AreaConfiguration &conf) {
                                return conf->restore(pMainBlackboard, bSync, errors) && accumulator;
                            });
 }
 
+void CDomainConfiguration::restoreDelta(CParameterBlackboard *pMainBlackboard,
+                                        const CDomainConfiguration &fromConfiguration,
+                                        CSyncerSet &syncerSet) const
+{
+    // This configuration last, as the most recently used
+    fromConfiguration.decodeSettings();
+    decodeSettings();
+
+    auto &deltas = mDeltas[&fromConfiguration];
+    deltas.resize(mAreaConfigurationList.size());
+
+    auto fromIt = begin(fromConfiguration.mAreaConfigurationList);
+    auto deltaIt = begin(deltas);
+
+    for (const auto &areaConfiguration : mAreaConfigurationList) {
+
+        if (fromIt == end(fromConfiguration.mAreaConfigurationList) ||
+            (*fromIt)->getConfigurableElement() != areaConfiguration->getConfigurableElement()) {
+
+            // Areas do not match (element sequences differ), restore the whole area
+            areaConfiguration->restore(pMainBlackboard, false, nullptr);
+            syncerSet += areaConfiguration->getSyncerSet();
+        } else if (areaConfiguration->restoreDelta(pMainBlackboard, **fromIt, *deltaIt)) {
+
+            syncerSet += areaConfiguration->getSyncerSet();
+        }
+        if (fromIt != end(fromConfiguration.mAreaConfigurationList)) {
+            ++fromIt;
+        }
+        ++deltaIt;
+    }
+}
+
+void CDomainConfiguration::clearDeltas()
+{
+    mDeltas.clear();
+}
+
+// Lazy settings
+void CDomainConfiguration::decodeSettings() const
+{
+    if (mLazySettings == nullptr) {
+
+        return;
+    }
+    if (!mLazySettings->bDecoded) {
+
+        for (auto &area : mLazySettings->areas) {
+
+            area.pAreaConfiguration->allocateSettings();
+
+            CParameterBlackboard &blackboard = area.pAreaConfiguration->getBlackboard();
+
+            blackboard.writeBuffer(area.pSettings, blackboard.getSize(), 0);
+        }
+        mLazySettings->bDecoded = true;
+        mLazySettings->uiDecodedGeneration = getLazySettingsGeneration();
+    }
+    if (mLazySettings->cache != nullptr) {
+
+        mLazySettings->cache->use(*this);
+    }
+}
+
+void CDomainConfiguration::pinSettings()
+{
+    if (mLazySettings == nullptr) {
+
+        return;
+    }
+    decodeSettings();
+
+    if (mLazySettings->cache != nullptr) {
+
+        mLazySettings->cache->remove(*this);
+    }
+    mLazySettings.reset();
+}
+
+void CDomainConfiguration::evictSettings() const
+{
+    if (mLazySettings == nullptr || !mLazySettings->bDecoded) {
+
+        return;
+    }
+    if (getLazySettingsGeneration() != mLazySettings->uiDecodedGeneration) {
+
+        // Modified since decoded (tuning), settings cannot be decoded again
+        if (mLazySettings->cache != nullptr) {
+
+            mLazySettings->cache->remove(*this);
+        }
+        mLazySettings.reset();
+        return;
+    }
+    for (auto &area : mLazySettings->areas) {
+
+        area.pAreaConfiguration->releaseSettings();
+    }
+    mLazySettings->bDecoded = false;
+
+    // The plan refers to the released settings
+    mRestorePlan.clear();
+}
+
+uint64_t CDomainConfiguration::getLazySettingsGeneration() const
+{
+    return std::accumulate(begin(mLazySettings->areas), end(mLazySettings->areas), uint64_t{0},
+                           [](uint64_t generation, const LazySettings::Area &area) {
+                               return generation +
+                                      area.pAreaConfiguration->getBlackboard().getGeneration();
+                           });
+}
+
 // Ensure validity for configurable element area configuration
 void CDomainConfiguration::validate(const CConfigurableElement *pConfigurableElement,
                                     const CParameterBlackboard *pMainBlackboard)
@@ -377,6 +678,8 @@ bool CDomainConfiguration::isValid(const CConfigurableElement *pConfigurableElem
 void CDomainConfiguration::validateAgainst(const CDomainConfiguration *pValidDomainConfiguration,
                                            const CConfigurableElement *pConfigurableElement)
 {
+    pValidDomainConfiguration->decodeSettings();
+
     // Retrieve related area configurations
     auto &areaConfigurationToValidate = getAreaConfiguration(pConfigurableElement);
     const auto &areaConfigurationToValidateAgainst =
@@ -388,6 +691,8 @@ void CDomainConfiguration::validateAgainst(const CDomainConfiguration *pValidDom
 
 void CDomainConfiguration::validateAgainst(const CDomainConfiguration *validDomainConfiguration)
 {
+    validDomainConfiguration->decodeSettings();
+
     ALWAYS_ASSERT(mAreaConfigurationList.size() ==
                       validDomainConfiguration->mAreaConfigurationList.size(),
                   "Cannot validate domain configuration "
@@ -406,16 +711,33 @@ void CDomainConfiguration::validateAgainst(const CDomainConfiguration *validDoma
 
 // Dynamic data application
 bool CDomainConfiguration::isApplicable() const
+{
+    return mRuleProgram.matches();
+}
+
+// Compiled application rule
+const CRuleProgram &CDomainConfiguration::getRuleProgram() const
+{
+    return mRuleProgram;
+}
+
+// Criteria dependencies
+void CDomainConfiguration::gatherCriteria(std::set<const CSelectionCriterion *> &criteria) const
 {
     const CCompoundRule *pRule = getRule();
 
-    return pRule && pRule->matches();
+    if (pRule) {
+
+        pRule->gatherCriteria(criteria);
+    }
 }
 
 // Merge existing configurations to given configurable element ones
 void CDomainConfiguration::merge(CConfigurableElement *pToConfigurableElement,
                                  CConfigurableElement *pFromConfigurableElement)
 {
+    pinSettings();
+
     // Retrieve related area configurations
     auto &areaConfigurationToMergeTo = getAreaConfiguration(pToConfigurableElement);
     const auto &areaConfigurationToMergeFrom = getAreaConfiguration(pFromConfigurableElement);
@@ -427,6 +749,8 @@ void CDomainConfiguration::merge(CConfigurableElement *pToConfigurableElement,
 // Domain splitting
 void CDomainConfiguration::split(CConfigurableElement *pFromConfigurableElement)
 {
+    pinSettings();
+
     // Retrieve related area configuration
     const auto &areaConfigurationToSplitFrom = getAreaConfiguration(pFromConfigurableElement);
 
@@ -506,4 +830,6 @@ void CDomainConfiguration::setRule(CCompoundRule *pRule)
         // Chain
         addChild(pRule);
     }
+    // Compile it
+    mRuleProgram.compile(pRule);
 }
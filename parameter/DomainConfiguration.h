@@ -34,7 +34,11 @@
 #include "XmlDomainExportContext.h"
 #include "Element.h"
 #include "Results.h"
+#include "RuleProgram.h"
 #include <list>
+#include <map>
+#include "RestorePlan.h"
+#include <set>
 #include <string>
 #include <memory>
 
@@ -44,6 +48,10 @@ class CConfigurationAccessContext;
 class CCompoundRule;
 class CSyncerSet;
 class CSelectionCriteriaDefinition;
+class CSelectionCriterion;
+class CDomainsBundleWriter;
+class CDomainsBundleReader;
+class CLazySettingsCache;
 
 class CDomainConfiguration : public CElement
 {
@@ -54,6 +62,7 @@ class CDomainConfiguration : public CElement
 
 public:
     CDomainConfiguration(const std::string &strName);
+    ~CDomainConfiguration() override;
 
     // Configurable Elements association
     void addConfigurableElement(const CConfigurableElement *configurableElement,
@@ -94,6 +103,21 @@ public:
     bool restore(CParameterBlackboard *pMainBlackboard, bool bSync,
                  core::Results *errors = nullptr) const;
 
+    /** Restore what differs from another configuration of the domain
+     *
+     * The main blackboard is expected to hold the other configuration. Differing ranges are
+     * computed once, then reused until either configuration is modified.
+     *
+     * @param[in] pMainBlackboard the application main blackboard
+     * @param[in] fromConfiguration the configuration held by the main blackboard
+     * @param[out] syncerSet the set collecting the syncers of the restored areas
+     */
+    void restoreDelta(CParameterBlackboard *pMainBlackboard,
+                      const CDomainConfiguration &fromConfiguration, CSyncerSet &syncerSet) const;
+
+    // Forget differing ranges with other configurations, to be called when areas change
+    void clearDeltas();
+
     // Ensure validity for configurable element area configuration
     void validate(const CConfigurableElement *pConfigurableElement,
                   const CParameterBlackboard *pMainBlackboard);
@@ -109,6 +133,10 @@ public:
     void validateAgainst(const CDomainConfiguration *validDomainConfiguration);
     // Applicability checking
     bool isApplicable() const;
+    // Compiled application rule
+    const CRuleProgram &getRuleProgram() const;
+    // Gather the selection criteria the application rule depends on
+    void gatherCriteria(std::set<const CSelectionCriterion *> &criteria) const;
     // Merge existing configurations to given configurable element ones
     void merge(CConfigurableElement *pToConfigurableElement,
                CConfigurableElement *pFromConfigurableElement);
@@ -121,6 +149,35 @@ public:
     void composeSettings(CXmlElement &xmlConfigurationSettingsElement,
                          CXmlDomainExportContext &context) const;
 
+    // From IXmlSink
+    bool fromXml(const CXmlElement &xmlElement,
+                 CXmlSerializingContext &serializingContext) override;
+
+    /** Domains bundle serialization
+     *
+     * The application rule is serialized along with the configuration, settings are serialized
+     * separately as elements must be associated to the domain beforehand.
+     *
+     * When the reader requires lazy settings, valid settings are left in the bundle and decoded
+     * into the areas when first used.
+     *
+     * @param[in] lazySettingsCache evicts the least recently used decoded settings of the
+     *            domain, nullptr to keep them once decoded
+     * @{
+     */
+    void toBundle(CDomainsBundleWriter &writer) const;
+    bool fromBundle(CDomainsBundleReader &reader);
+    void settingsToBundle(CDomainsBundleWriter &writer) const;
+    bool settingsFromBundle(CDomainsBundleReader &reader,
+                            std::shared_ptr<CLazySettingsCache> lazySettingsCache = nullptr);
+    /** @} */
+
+    /** Release decoded lazy settings, to be decoded again when used
+     *
+     * Settings modified since decoded are kept, the configuration not being lazy anymore.
+     */
+    void evictSettings() const;
+
     // Class kind
     std::string getKind() const override;
 
@@ -151,10 +208,50 @@ private:
     AreaConfigurations::iterator findAreaConfigurationByPath(
         const std::string &configurableElementPath);
 
+    /** Settings of a lazy configuration, decoded into their areas when first used */
+    struct LazySettings
+    {
+        struct Area
+        {
+            CAreaConfiguration *pAreaConfiguration;
+            // Raw settings, in the bundle
+            const uint8_t *pSettings;
+        };
+        // Areas released until decoded
+        std::vector<Area> areas;
+        // Keeps raw settings valid
+        std::shared_ptr<const void> bundle;
+        // Evicts the least recently used decoded settings, if any
+        std::shared_ptr<CLazySettingsCache> cache;
+        bool bDecoded{false};
+        // Sum of the areas blackboard generations once decoded, to detect modifications
+        uint64_t uiDecodedGeneration{0};
+    };
+
+    /** Decode lazy settings if not yet done, before any access to the areas */
+    void decodeSettings() const;
+    /** Decode lazy settings for good, before modifying the areas or their sequence */
+    void pinSettings();
+    // Sum of the lazy areas blackboard generations
+    uint64_t getLazySettingsGeneration() const;
+
     // Rule
     const CCompoundRule *getRule() const;
     CCompoundRule *getRule();
     void setRule(CCompoundRule *pRule);
 
     AreaConfigurations mAreaConfigurationList;
+
+    /** Compiled form of the application rule, used for applicability checking */
+    CRuleProgram mRuleProgram;
+
+    /** Flat restoration of all areas, rebuilt when out of date */
+    mutable CRestorePlan mRestorePlan;
+
+    /** Differing ranges with other configurations, per area, in area order */
+    mutable std::map<const CDomainConfiguration *, std::vector<CAreaConfiguration::Delta>>
+        mDeltas;
+
+    /** Undecoded or evictable settings, nullptr if decoded for good */
+    mutable std::unique_ptr<LazySettings> mLazySettings;
 };
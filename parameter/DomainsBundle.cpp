@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "DomainsBundle.h"
+#include "ConfigurableElement.h"
+#include "InstanceConfigurableElement.h"
+#include "TypeElement.h"
+#include "SystemClass.h"
+
+using std::string;
+
+namespace domainsBundle
+{
+
+CStructure::CStructure(CSystemClass &systemClass)
+{
+    mHash.addString(systemClass.getName());
+
+    for (size_t child = 0; child < systemClass.getNbChildren(); child++) {
+
+        add(*static_cast<CConfigurableElement *>(systemClass.getChild(child)));
+    }
+}
+
+void CStructure::add(CConfigurableElement &element)
+{
+    mElements.push_back(&element);
+
+    mHash.addString(element.getName());
+    mHash.addString(element.getKind());
+    mHash.addInteger(element.getOffset());
+    mHash.addInteger(element.getFootPrint());
+    mHash.addInteger(element.getNbChildren());
+
+    // Sign, range, fixed point format, adaptation, enum values and bit position define the
+    // blackboard encoding of the settings: hash them through the type properties
+    auto *instance = dynamic_cast<const CInstanceConfigurableElement *>(&element);
+    if (instance != nullptr) {
+
+        string properties;
+        instance->getTypeElement()->showProperties(properties);
+        mHash.addString(properties);
+    }
+
+    for (size_t child = 0; child < element.getNbChildren(); child++) {
+
+        add(*static_cast<CConfigurableElement *>(element.getChild(child)));
+    }
+}
+
+uint64_t CStructure::getHash() const
+{
+    return mHash.get();
+}
+
+CConfigurableElement *CStructure::getElement(uint32_t index) const
+{
+    return index < mElements.size() ? mElements[index] : nullptr;
+}
+
+const std::vector<CConfigurableElement *> &CStructure::getElements() const
+{
+    return mElements;
+}
+
+} // namespace domainsBundle
+
+// Writer
+CDomainsBundleWriter::CDomainsBundleWriter(CSystemClass &systemClass)
+    : mStructure(systemClass)
+{
+    const auto &elements = mStructure.getElements();
+
+    for (size_t index = 0; index < elements.size(); index++) {
+
+        mIndexes[elements[index]] = static_cast<uint32_t>(index);
+    }
+    writeBytes(domainsBundle::gMagic, sizeof(domainsBundle::gMagic));
+    write(domainsBundle::gVersion);
+    write(mStructure.getHash());
+}
+
+void CDomainsBundleWriter::writeString(const string &value)
+{
+    mWriter.writeString(value);
+}
+
+void CDomainsBundleWriter::writeBytes(const void *data, size_t size)
+{
+    mWriter.writeBytes(data, size);
+}
+
+uint32_t CDomainsBundleWriter::getElementIndex(
+    const CConfigurableElement *pConfigurableElement) const
+{
+    // Domains only hold elements of the structure
+    return mIndexes.at(pConfigurableElement);
+}
+
+const std::vector<uint8_t> &CDomainsBundleWriter::getData() const
+{
+    return mWriter.getData();
+}
+
+// Reader
+const char *const CDomainsBundleReader::gTruncated = "Truncated domains bundle";
+
+CDomainsBundleReader::CDomainsBundleReader(
+    const uint8_t *data, size_t size, CSystemClass &systemClass,
+    const CSelectionCriteriaDefinition *pSelectionCriteriaDefinition, string &strError)
+    : mReader(data, size), mStructure(systemClass),
+      mSelectionCriteriaDefinition(pSelectionCriteriaDefinition), mError(strError)
+{
+}
+
+bool CDomainsBundleReader::readHeader()
+{
+    const uint8_t *magic = readBytes(sizeof(domainsBundle::gMagic));
+
+    if (magic == nullptr || memcmp(magic, domainsBundle::gMagic, sizeof(domainsBundle::gMagic))) {
+
+        return fail("Not a domains bundle");
+    }
+    uint32_t version;
+
+    if (!read(version)) {
+
+        return false;
+    }
+    if (version != domainsBundle::gVersion) {
+
+        return fail("Unsupported domains bundle version " + std::to_string(version) +
+                    ", expected " + std::to_string(domainsBundle::gVersion));
+    }
+    uint64_t hash;
+
+    if (!read(hash)) {
+
+        return false;
+    }
+    if (hash != mStructure.getHash()) {
+
+        return fail("Domains bundle compiled for another structure");
+    }
+    return true;
+}
+
+bool CDomainsBundleReader::readString(string &value)
+{
+    return mReader.readString(value) || fail(gTruncated);
+}
+
+const uint8_t *CDomainsBundleReader::readBytes(size_t size)
+{
+    const uint8_t *data = mReader.readBytes(size);
+
+    if (data == nullptr) {
+
+        fail(gTruncated);
+    }
+    return data;
+}
+
+CConfigurableElement *CDomainsBundleReader::readElement()
+{
+    uint32_t index;
+
+    if (!read(index)) {
+
+        return nullptr;
+    }
+    CConfigurableElement *pConfigurableElement = mStructure.getElement(index);
+
+    if (pConfigurableElement == nullptr) {
+
+        fail("Invalid element index " + std::to_string(index) + " in domains bundle");
+    }
+    return pConfigurableElement;
+}
+
+const CSelectionCriteriaDefinition *CDomainsBundleReader::getSelectionCriteriaDefinition() const
+{
+    return mSelectionCriteriaDefinition;
+}
+
+void CDomainsBundleReader::setLazySettings(std::shared_ptr<const void> bundle, size_t cacheSize)
+{
+    mLazyBundle = std::move(bundle);
+    mLazySettingsCacheSize = cacheSize;
+}
+
+const std::shared_ptr<const void> &CDomainsBundleReader::getLazyBundle() const
+{
+    return mLazyBundle;
+}
+
+size_t CDomainsBundleReader::getLazySettingsCacheSize() const
+{
+    return mLazySettingsCacheSize;
+}
+
+bool CDomainsBundleReader::fail(const string &strError)
+{
+    if (mError.empty()) {
+
+        mError = strError;
+    }
+    return false;
+}
+
+bool CDomainsBundleReader::atEnd() const
+{
+    return mReader.atEnd();
+}
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "NonCopyable.hpp"
+#include "BinaryBuffer.hpp"
+#include "Fnv1aHash.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class CConfigurableElement;
+class CSelectionCriteriaDefinition;
+class CSystemClass;
+
+/** Compiled binary form of the configurable domains with their settings
+ *
+ * Loading a bundle does not involve any XML nor value parsing: elements are designated by their
+ * index in the structure, rules are stored as trees and settings as raw area blackboards.
+ * A bundle is only valid for the structure it was compiled against, as checked by comparing
+ * structure hashes.
+ *
+ * Layout, integers being little endian and strings stored as their uint32_t size then content:
+ *  - header: magic, uint32_t version, uint64_t structure hash
+ *  - uint32_t domain count, then domains
+ *  - per domain: name, uint8_t sequence awareness, uint32_t configuration count,
+ *    configurations, uint32_t element count, elements, then configuration settings
+ *  - per configuration: name, uint8_t rule presence, rule
+ *  - per element: uint32_t structure index, uint64_t offset, uint64_t footprint
+ *  - per configuration settings: uint32_t area count, then areas in sequence order
+ *  - per area: uint32_t structure index, uint8_t validity, uint64_t size, raw settings
+ *  - compound rule: uint8_t type, uint32_t child count, per child uint8_t kind then the rule
+ *  - criterion rule: criterion name, uint8_t matching rule, literal value
+ */
+namespace domainsBundle
+{
+
+/** First bytes of a bundle file */
+static const char gMagic[] = {'P', 'F', 'W', 'B'};
+
+/** To be increased on any layout change */
+static const uint32_t gVersion = 1;
+
+/** Kinds of rules, in rule trees */
+enum RuleKind : uint8_t
+{
+    ECompoundRule,
+    ESelectionCriterionRule
+};
+
+/** Configurable elements of a structure, in depth first order, and the structure hash
+ *
+ * The hash covers the name, kind, offset and footprint of every element, so that bundles
+ * are rejected as soon as the blackboard layout or the element indexes may differ.
+ */
+class CStructure : private utility::NonCopyable
+{
+public:
+    CStructure(CSystemClass &systemClass);
+
+    uint64_t getHash() const;
+
+    /** @return the element of given index, nullptr if out of range */
+    CConfigurableElement *getElement(uint32_t index) const;
+
+    /** @return the elements, in index order */
+    const std::vector<CConfigurableElement *> &getElements() const;
+
+private:
+    void add(CConfigurableElement &element);
+
+    std::vector<CConfigurableElement *> mElements;
+    utility::Fnv1aHash mHash;
+};
+
+} // namespace domainsBundle
+
+/** Serialization of domains to a bundle */
+class CDomainsBundleWriter : private utility::NonCopyable
+{
+public:
+    /** Write the bundle header
+     *
+     * @param[in] systemClass the structure the domains belong to
+     */
+    CDomainsBundleWriter(CSystemClass &systemClass);
+
+    template <class T>
+    void write(T value)
+    {
+        mWriter.write(value);
+    }
+    void writeString(const std::string &value);
+    void writeBytes(const void *data, size_t size);
+
+    /** @return the structure index of an element */
+    uint32_t getElementIndex(const CConfigurableElement *pConfigurableElement) const;
+
+    /** @return the bundle content */
+    const std::vector<uint8_t> &getData() const;
+
+private:
+    domainsBundle::CStructure mStructure;
+    std::unordered_map<const CConfigurableElement *, uint32_t> mIndexes;
+    utility::BinaryWriter mWriter;
+};
+
+/** Deserialization of domains from a bundle
+ *
+ * Reads fail instead of going past the end of the bundle, so that truncated or corrupted
+ * bundles are rejected.
+ */
+class CDomainsBundleReader : private utility::NonCopyable
+{
+public:
+    /**
+     * @param[in] data the bundle content, to be kept valid during the reader lifetime
+     * @param[in] size the bundle size
+     * @param[in] systemClass the structure to load the domains for
+     * @param[in] pSelectionCriteriaDefinition the criteria referenced by the rules
+     * @param[out] strError the error on failure
+     */
+    CDomainsBundleReader(const uint8_t *data, size_t size, CSystemClass &systemClass,
+                         const CSelectionCriteriaDefinition *pSelectionCriteriaDefinition,
+                         std::string &strError);
+
+    /** Read and check the bundle header
+     *
+     * @return false if not a bundle, or if compiled for another version or structure
+     */
+    bool readHeader();
+
+    template <class T>
+    bool read(T &value)
+    {
+        if (mReader.read(value)) {
+            return true;
+        }
+        // Explicitly false: fail() is not inlined, callers would be seen as using unread values
+        fail(gTruncated);
+        return false;
+    }
+    bool readString(std::string &value);
+
+    /** @return the location of the next size bytes, nullptr if past the end of the bundle */
+    const uint8_t *readBytes(size_t size);
+
+    /** Read an element structure index
+     *
+     * @return the element, nullptr if the index is out of range
+     */
+    CConfigurableElement *readElement();
+
+    const CSelectionCriteriaDefinition *getSelectionCriteriaDefinition() const;
+
+    /** Leave valid settings in the bundle, to be decoded when first used
+     *
+     * @param[in] bundle keeps the bundle content valid as long as settings refer to it
+     * @param[in] cacheSize the maximum count of decoded configurations per domain, 0 for no limit
+     */
+    void setLazySettings(std::shared_ptr<const void> bundle, size_t cacheSize);
+    /** @return the bundle to keep for lazy settings, nullptr if settings are copied */
+    const std::shared_ptr<const void> &getLazyBundle() const;
+    size_t getLazySettingsCacheSize() const;
+
+    /** Set the error and fail, if not already failed with a more detailed error */
+    bool fail(const std::string &strError);
+
+    /** @return true if the whole bundle has been read */
+    bool atEnd() const;
+
+private:
+    static const char *const gTruncated;
+
+    utility::BinaryReader mReader;
+    domainsBundle::CStructure mStructure;
+    const CSelectionCriteriaDefinition *mSelectionCriteriaDefinition;
+    std::string &mError;
+
+    std::shared_ptr<const void> mLazyBundle;
+    size_t mLazySettingsCacheSize{0};
+};
@@ -42,6 +42,8 @@ using std::string;
 
 const std::string CElement::gDescriptionPropertyName = "Description";
 
+const size_t CElement::gChildIndexThreshold = 16;
+
 CElement::CElement(const string &strName) : _strName(strName)
 {
 }
@@ -234,7 +236,18 @@ void CElement::setXmlNameAttribute(CXmlElement &xmlElement) const
 // Name
 void CElement::setName(const string &strName)
 {
+    if (!_pParent || !_pParent->_childIndex) {
+
+        _strName = strName;
+        return;
+    }
+    // Keep the parent index in sync
+    string strOldPathName = getPathName();
+
     _strName = strName;
+
+    _pParent->reindexChild(strOldPathName);
+    _pParent->reindexChild(getPathName());
 }
 
 const string &CElement::getName() const
@@ -264,6 +277,15 @@ bool CElement::rename(const string &strName, string &strError)
     return true;
 }
 
+bool CElement::hasPathName(const string &strName) const
+{
+    if (!_strName.empty()) {
+
+        return _strName == strName;
+    }
+    return getKind() == strName;
+}
+
 string CElement::getPathName() const
 {
     if (!_strName.empty()) {
@@ -281,6 +303,34 @@ void CElement::addChild(CElement *pChild)
     _childArray.push_back(pChild);
 
     pChild->_pParent = this;
+
+    if (_childIndex) {
+
+        // Homonymous children are hidden by the first one
+        _childIndex->emplace(pChild->getPathName(), pChild);
+    } else if (_childArray.size() > gChildIndexThreshold) {
+
+        _childIndex.reset(new std::unordered_map<string, CElement *>);
+
+        for (CElement *pIndexedChild : _childArray) {
+
+            _childIndex->emplace(pIndexedChild->getPathName(), pIndexedChild);
+        }
+    }
+}
+
+void CElement::reindexChild(const string &strPathName)
+{
+    auto childIt = std::find_if(begin(_childArray), end(_childArray), [&](const CElement *pChild) {
+        return pChild->hasPathName(strPathName);
+    });
+    if (childIt != end(_childArray)) {
+
+        (*_childIndex)[strPathName] = *childIt;
+    } else {
+
+        _childIndex->erase(strPathName);
+    }
 }
 
 CElement *CElement::getChild(size_t index)
@@ -326,6 +376,11 @@ bool CElement::removeChild(CElement *pChild)
     if (childIt != end(_childArray)) {
 
         _childArray.erase(childIt);
+
+        if (_childIndex) {
+
+            reindexChild(pChild->getPathName());
+        }
         return true;
     }
     return false;
@@ -408,6 +463,7 @@ void CElement::removeChildren()
         delete *it;
     }
     _childArray.clear();
+    _childIndex.reset();
 }
 
 const CElement *CElement::findDescendant(CPathNavigator &pathNavigator) const
@@ -463,22 +519,21 @@ bool CElement::isDescendantOf(const CElement *pCandidateAscendant) const
 
 CElement *CElement::findChild(const string &strName)
 {
-    for (CElement *pChild : _childArray) {
-
-        if (pChild->getPathName() == strName) {
-
-            return pChild;
-        }
-    }
-
-    return nullptr;
+    const auto *constThis = this;
+    return const_cast<CElement *>(constThis->findChild(strName));
 }
 
 const CElement *CElement::findChild(const string &strName) const
 {
+    if (_childIndex) {
+
+        auto indexIt = _childIndex->find(strName);
+
+        return indexIt != _childIndex->end() ? indexIt->second : nullptr;
+    }
     for (CElement *pChild : _childArray) {
 
-        if (pChild->getPathName() == strName) {
+        if (pChild->hasPathName(strName)) {
 
             return pChild;
         }
@@ -31,7 +31,9 @@
 
 #include "parameter_export.h"
 
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <stdint.h>
 #include "XmlSink.h"
@@ -61,6 +63,8 @@ public:
     bool rename(const std::string &strName, std::string &strError);
     std::string getPath() const;
     std::string getQualifiedPath() const;
+    // Returns Name or Kind if no Name
+    std::string getPathName() const;
 
     // Creation / build
     virtual bool init(std::string &strError);
@@ -175,14 +179,16 @@ protected:
     static const std::string gDescriptionPropertyName;
 
 private:
-    // Returns Name or Kind if no Name
-    std::string getPathName() const;
     // Returns true if children dynamic creation is to be dealt with
     virtual bool childrenAreDynamic() const;
     // House keeping
     void removeChildren();
     // Fill XmlElement during XML composing
     void setXmlNameAttribute(CXmlElement &xmlElement) const;
+    // Same as comparing getPathName(), without copying the name
+    bool hasPathName(const std::string &strName) const;
+    // Point the child index entry of a path name to the first child bearing it, if any
+    void reindexChild(const std::string &strPathName);
 
     // Name
     std::string _strName;
@@ -195,6 +201,10 @@ private:
     typedef std::vector<CElement *>::reverse_iterator ChildArrayReverseIterator;
     // Children
     std::vector<CElement *> _childArray;
+    // Children by path name, only indexed past gChildIndexThreshold children, when a linear
+    // lookup gets slower than hashing. The first of homonymous children is the indexed one.
+    std::unique_ptr<std::unordered_map<std::string, CElement *>> _childIndex;
+    static const size_t gChildIndexThreshold;
     // Parent
     CElement *_pParent{nullptr};
 };
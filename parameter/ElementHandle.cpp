@@ -30,16 +30,14 @@
 #include "ElementHandle.h"
 #include "ParameterAccessContext.h"
 #include "BaseParameter.h"
+#include "Parameter.h"
+#include "ParameterType.h"
 #include "XmlParameterSerializingContext.h"
 #include "Subsystem.h"
 #include <assert.h>
 #include "ParameterMgr.h"
 
-#include <mutex>
-
 using std::string;
-using std::mutex;
-using std::lock_guard;
 
 /** @return 0 by default, ie for non overloaded types. */
 template <class T>
@@ -215,9 +213,13 @@ bool ElementHandle::setAs(const T value, string &error) const
     T copy = value;
 
     // Ensure we're safe against blackboard foreign access
-    lock_guard<mutex> autoLock(mParameterMgr.getBlackboardMutex());
+    CParameterMgr::CBlackboardLock autoLock(mParameterMgr, &mElement);
 
-    return parameter.access(copy, true, parameterAccessContext);
+    if (not parameter.access(copy, true, parameterAccessContext)) {
+        return false;
+    }
+    mParameterMgr.publishBlackboardSnapshot();
+    return true;
 }
 
 template <class T>
@@ -229,10 +231,10 @@ bool ElementHandle::getAs(T &value, string &error) const
     // Safe downcast thanks to isParameter check in checkGetValidity
     auto &parameter = static_cast<const CBaseParameter &>(mElement);
 
-    // Ensure we're safe against blackboard foreign access
-    lock_guard<mutex> autoLock(mParameterMgr.getBlackboardMutex());
+    // Read the published content, without waiting for a running application
+    CParameterMgr::CBlackboardReader reader(mParameterMgr, &mElement);
 
-    CParameterAccessContext parameterAccessContext(error, mParameterMgr.getParameterBlackboard());
+    CParameterAccessContext parameterAccessContext(error, reader.getBlackboard());
 
     return parameter.access(value, false, parameterAccessContext);
 }
@@ -342,6 +344,88 @@ bool ElementHandle::getAsStringArray(std::vector<string> &value, string &error)
     return getAs(value, error);
 }
 
+template <class T>
+BoundParameter<T> ElementHandle::bind(string &error) const
+{
+    ScalarCodec codec;
+    const CParameter *parameter = getScalarCodec(false, codec, error);
+
+    if (parameter == nullptr) {
+        return {};
+    }
+    if (not BoundParameter<T>::isSupported(codec)) {
+
+        error = "Can not bind \"" + getPath() + "\": unsupported conversion.";
+        return {};
+    }
+    return BoundParameter<T>(*parameter, mParameterMgr, codec);
+}
+
+template BoundParameter<bool> ElementHandle::bind(string &error) const;
+template BoundParameter<uint32_t> ElementHandle::bind(string &error) const;
+template BoundParameter<int32_t> ElementHandle::bind(string &error) const;
+template BoundParameter<double> ElementHandle::bind(string &error) const;
+
+ParameterArrayView ElementHandle::getArrayView(string &error) const
+{
+    ScalarCodec codec;
+    const CParameter *parameter = getScalarCodec(true, codec, error);
+
+    if (parameter == nullptr) {
+        return {};
+    }
+    return ParameterArrayView(mParameterMgr, *parameter, codec, false);
+}
+
+WritableParameterArrayView ElementHandle::getWritableArrayView(string &error)
+{
+    if (not checkSetValidity(getArrayLength(), error)) {
+        return {};
+    }
+    if (mParameterMgr.tuningModeOn()) {
+
+        error = "Can not write \"" + getPath() + "\" in tuning mode.";
+        return {};
+    }
+    ScalarCodec codec;
+    const CParameter *parameter = getScalarCodec(true, codec, error);
+
+    if (parameter == nullptr) {
+        return {};
+    }
+    // Only raw integers can be written without conversion
+    if (codec.kind != ScalarCodec::Kind::Integer) {
+
+        error = "Can not write \"" + getPath() + "\" as its elements are not integers.";
+        return {};
+    }
+    return WritableParameterArrayView(mParameterMgr, *parameter, codec);
+}
+
+const CParameter *ElementHandle::getScalarCodec(bool asArray, ScalarCodec &codec,
+                                                string &error) const
+{
+    if (not checkGetValidity(asArray, error)) {
+        return nullptr;
+    }
+    // Bit and string parameters are not encoded as a whole integer
+    auto &parameter = static_cast<const CBaseParameter &>(mElement);
+
+    if (parameter.getType() != CInstanceConfigurableElement::EParameter) {
+
+        error = "Can not access \"" + getPath() + "\" directly as it is a " + getKind() + ".";
+        return nullptr;
+    }
+    auto &scalar = static_cast<const CParameter &>(parameter);
+
+    if (not static_cast<const CParameterType *>(scalar.getTypeElement())->getScalarCodec(codec)) {
+
+        error = "Can not access \"" + getPath() + "\" directly: unsupported type.";
+        return nullptr;
+    }
+    return &scalar;
+}
+
 bool ElementHandle::checkGetValidity(bool asArray, string &error) const
 {
     if (not isParameter()) {
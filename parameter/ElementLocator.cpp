@@ -28,18 +28,31 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include "ElementLocator.h"
+#include "ConfigurableElement.h"
 #include "PathNavigator.h"
 
 using std::string;
 
-CElementLocator::CElementLocator(CElement *pSubRootElement, bool bStrict)
-    : _pSubRootElement(pSubRootElement), _bStrict(bStrict)
+CElementLocator::CElementLocator(CElement *pSubRootElement, bool bStrict,
+                                 const CPathIndex *pPathIndex)
+    : _pSubRootElement(pSubRootElement), _bStrict(bStrict), _pPathIndex(pPathIndex)
 {
 }
 
 // Locate element
 bool CElementLocator::locate(const string &strPath, CElement **ppElement, string &strError)
 {
+    if (_pPathIndex) {
+
+        CElement *pElement = _pPathIndex->find(strPath);
+
+        if (pElement) {
+
+            *ppElement = pElement;
+            return true;
+        }
+    }
+
     CPathNavigator pathNavigator(strPath);
 
     if (!pathNavigator.isPathValid()) {
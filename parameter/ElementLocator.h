@@ -30,13 +30,17 @@
 #pragma once
 
 #include "Element.h"
+#include "PathIndex.h"
 
 #include <string>
 
 class CElementLocator
 {
 public:
-    CElementLocator(CElement *pSubRootElement, bool bStrict = true);
+    /** @param[in] pPathIndex the index of the sub root element tree, if any, consulted before
+     *                        navigating it */
+    CElementLocator(CElement *pSubRootElement, bool bStrict = true,
+                    const CPathIndex *pPathIndex = nullptr);
 
     // Locate element
     bool locate(const std::string &strPath, CElement **ppElement, std::string &strError);
@@ -47,4 +51,6 @@ private:
 
     // Strict means empty path will cause path not found error to be returned
     bool _bStrict;
+
+    const CPathIndex *_pPathIndex;
 };
@@ -35,6 +35,7 @@
 #include <math.h>
 #include "Parameter.h"
 #include "ParameterAccessContext.h"
+#include "BoundParameter.h"
 #include "ConfigurationAccessContext.h"
 #include "Utility.h"
 #include <errno.h>
@@ -267,6 +268,18 @@ bool CFixedPointParameterType::fromBlackboard(double &dUserValue, uint32_t uiVal
     return true;
 }
 
+// Precompiled accessors
+bool CFixedPointParameterType::getScalarCodec(ScalarCodec &codec) const
+{
+    codec.kind = ScalarCodec::Kind::FixedPoint;
+    codec.size = getSize();
+    codec.fractional = _uiFractional;
+    codec.justification = static_cast<uint32_t>(getSize() * 8 - getUtilSizeInBits());
+    getRange(codec.doubleMin, codec.doubleMax);
+
+    return true;
+}
+
 // Util size
 size_t CFixedPointParameterType::getUtilSizeInBits() const
 {
@@ -63,6 +63,9 @@ public:
     bool fromBlackboard(double &dUserValue, uint32_t uiValue,
                         CParameterAccessContext &parameterAccessContext) const override;
 
+    // Precompiled accessors
+    bool getScalarCodec(ScalarCodec &codec) const override;
+
     // Element properties
     void showProperties(std::string &strResult) const override;
 
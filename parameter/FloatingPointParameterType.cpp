@@ -31,6 +31,7 @@
 #include <sstream>
 #include <iomanip>
 #include "ParameterAccessContext.h"
+#include "BoundParameter.h"
 #include "ConfigurationAccessContext.h"
 #include <limits>
 #include <climits>
@@ -256,6 +257,16 @@ bool CFloatingPointParameterType::fromBlackboard(double &dUserValue, uint32_t ui
     return true;
 }
 
+bool CFloatingPointParameterType::getScalarCodec(ScalarCodec &codec) const
+{
+    codec.kind = ScalarCodec::Kind::FloatingPoint;
+    codec.size = getSize();
+    codec.doubleMin = _fMin;
+    codec.doubleMax = _fMax;
+
+    return true;
+}
+
 bool CFloatingPointParameterType::checkValueAgainstRange(double dValue) const
 {
     // Check that dValue can safely be cast to a float
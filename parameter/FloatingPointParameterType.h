@@ -54,6 +54,8 @@ public:
     bool fromBlackboard(double &dUserValue, uint32_t uiValue,
                         CParameterAccessContext &parameterAccessContext) const override;
 
+    bool getScalarCodec(ScalarCodec &codec) const override;
+
     void showProperties(std::string &strResult) const override;
 
     std::string getKind() const override;
@@ -164,7 +164,7 @@ void CInstanceConfigurableElement::fillSyncerSetFromDescendant(CSyncerSet &synce
 {
     if (_pSyncer) {
 
-        syncerSet += _pSyncer;
+        syncerSet.add(_pSyncer, getBelongingSubsystem());
     } else {
         // Continue digging
         base::fillSyncerSetFromDescendant(syncerSet);
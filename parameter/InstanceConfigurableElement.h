@@ -43,6 +43,11 @@ class CParameterAccessContext;
 
 class PARAMETER_EXPORT CInstanceConfigurableElement : public CConfigurableElement
 {
+    // Precompiled accessors synchronize the parameter they write
+    template <class T>
+    friend class BoundParameter;
+    friend class WritableParameterArrayView;
+
 public:
     enum Type
     {
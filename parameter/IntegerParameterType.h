@@ -32,6 +32,7 @@
 #include "BaseIntegerParameterType.h"
 #include "ParameterAdaptation.h"
 #include "ParameterAccessContext.h"
+#include "BoundParameter.h"
 
 #include <convert.hpp>
 
@@ -266,6 +267,24 @@ public:
         return true;
     }
 
+    // Precompiled accessors
+    bool getScalarCodec(ScalarCodec &codec) const override
+    {
+        codec.kind = ScalarCodec::Kind::Integer;
+        codec.size = getSize();
+        codec.isSigned = isSigned;
+        codec.min = _min;
+        codec.max = _max;
+
+        const CParameterAdaptation *pParameterAdaption = getParameterAdaptation();
+
+        if (pParameterAdaption) {
+
+            pParameterAdaption->getScalarCodec(codec);
+        }
+        return true;
+    }
+
     // Default value handling (simulation only)
     uint32_t getDefaultValue() const override { return _min; }
 
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "LazySettingsCache.h"
+#include "DomainConfiguration.h"
+#include <algorithm>
+
+CLazySettingsCache::CLazySettingsCache(size_t maxCount) : mMaxCount(std::max<size_t>(maxCount, 2))
+{
+}
+
+void CLazySettingsCache::use(const CDomainConfiguration &configuration)
+{
+    auto position = mPositions.find(&configuration);
+
+    if (position != end(mPositions)) {
+
+        // Already decoded, now the most recently used
+        mUsed.splice(begin(mUsed), mUsed, position->second);
+        return;
+    }
+    mUsed.push_front(&configuration);
+    mPositions[&configuration] = begin(mUsed);
+
+    while (mUsed.size() > mMaxCount) {
+
+        const CDomainConfiguration *pLeastRecentlyUsed = mUsed.back();
+
+        mPositions.erase(pLeastRecentlyUsed);
+        mUsed.pop_back();
+
+        pLeastRecentlyUsed->evictSettings();
+    }
+}
+
+void CLazySettingsCache::remove(const CDomainConfiguration &configuration)
+{
+    auto position = mPositions.find(&configuration);
+
+    if (position != end(mPositions)) {
+
+        mUsed.erase(position->second);
+        mPositions.erase(position);
+    }
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "NonCopyable.hpp"
+
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+
+class CDomainConfiguration;
+
+/** Decoded settings of the lazy configurations of a domain, least recently used first evicted
+ *
+ * Configurations of a domain are restored by a single thread at a time, hence no locking.
+ */
+class CLazySettingsCache : private utility::NonCopyable
+{
+public:
+    /** @param[in] maxCount the maximum count of decoded configurations, at least 2 as restoring
+     *             a delta needs both configurations */
+    explicit CLazySettingsCache(size_t maxCount);
+
+    /** Record the use of decoded settings, evicting the least recently used beyond the maximum
+     *
+     * @param[in] configuration the configuration which settings were used
+     */
+    void use(const CDomainConfiguration &configuration);
+
+    /** Forget a configuration, which settings are not decoded anymore */
+    void remove(const CDomainConfiguration &configuration);
+
+private:
+    using Configurations = std::list<const CDomainConfiguration *>;
+
+    const size_t mMaxCount;
+
+    /** Configurations with decoded settings, most recently used first */
+    Configurations mUsed;
+    std::unordered_map<const CDomainConfiguration *, Configurations::iterator> mPositions;
+};
@@ -28,6 +28,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include "LinearParameterAdaptation.h"
+#include "BoundParameter.h"
 
 #define base CParameterAdaptation
 
@@ -88,3 +89,12 @@ double CLinearParameterAdaptation::toUserValue(int64_t iValue) const
 {
     return base::toUserValue(iValue) * _dSlopeDenominator / _dSlopeNumerator;
 }
+
+void CLinearParameterAdaptation::getScalarCodec(ScalarCodec &codec) const
+{
+    base::getScalarCodec(codec);
+
+    codec.adaptation = ScalarCodec::Adaptation::Linear;
+    codec.slopeNumerator = _dSlopeNumerator;
+    codec.slopeDenominator = _dSlopeDenominator;
+}
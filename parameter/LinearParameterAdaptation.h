@@ -42,6 +42,7 @@ public:
     // Conversions
     int64_t fromUserValue(double dValue) const override;
     double toUserValue(int64_t iValue) const override;
+    void getScalarCodec(ScalarCodec &codec) const override;
 
     // Element properties
     void showProperties(std::string &strResult) const override;
@@ -29,6 +29,7 @@
  */
 
 #include "LogarithmicParameterAdaptation.h"
+#include "BoundParameter.h"
 #include <cmath>
 #include <limits>
 #include <algorithm>
@@ -83,3 +84,12 @@ double CLogarithmicParameterAdaptation::toUserValue(int64_t iValue) const
 {
     return exp(base::toUserValue(iValue) * log(_dLogarithmBase));
 }
+
+void CLogarithmicParameterAdaptation::getScalarCodec(ScalarCodec &codec) const
+{
+    base::getScalarCodec(codec);
+
+    codec.adaptation = ScalarCodec::Adaptation::Logarithmic;
+    codec.logarithmBase = _dLogarithmBase;
+    codec.floorValue = _dFloorValue;
+}
@@ -55,6 +55,7 @@ public:
      */
     int64_t fromUserValue(double dValue) const override;
     double toUserValue(int64_t iValue) const override;
+    void getScalarCodec(ScalarCodec &codec) const override;
 
     void showProperties(std::string &strResult) const override;
 
@@ -28,6 +28,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include "ParameterAdaptation.h"
+#include "BoundParameter.h"
 
 #define base CElement
 
@@ -82,3 +83,9 @@ double CParameterAdaptation::toUserValue(int64_t iValue) const
 {
     return (double)(iValue - _iOffset);
 }
+
+void CParameterAdaptation::getScalarCodec(ScalarCodec &codec) const
+{
+    codec.adaptation = ScalarCodec::Adaptation::Offset;
+    codec.offset = _iOffset;
+}
@@ -33,6 +33,8 @@
 
 #include <string>
 
+struct ScalarCodec;
+
 class CParameterAdaptation : public CElement
 {
 public:
@@ -49,6 +51,9 @@ public:
     virtual int64_t fromUserValue(double dValue) const;
     virtual double toUserValue(int64_t iValue) const;
 
+    /** Describe the conversions in a codec, for precompiled accessors */
+    virtual void getScalarCodec(ScalarCodec &codec) const;
+
     // CElement
     std::string getKind() const override;
 
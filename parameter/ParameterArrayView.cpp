@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "ParameterArrayView.h"
+#include "ScalarCodecConversion.h"
+#include "Parameter.h"
+#include "ParameterAccessContext.h"
+#include "ParameterBlackboard.h"
+#include "ParameterMgr.h"
+
+#include <cstring>
+#include <utility>
+
+using Kind = ScalarCodec::Kind;
+using Adaptation = ScalarCodec::Adaptation;
+
+using namespace scalarCodec;
+
+struct ParameterArrayView::Guard
+{
+    Guard(CParameterMgr &parameterMgr, const CParameter &parameter, bool bWritable)
+        : mParameterMgr(parameterMgr), mParameter(parameter),
+          mReader(bWritable ? nullptr
+                            : new CParameterMgr::CBlackboardReader(parameterMgr, &parameter)),
+          mLock(parameterMgr, &parameter, bWritable)
+    {
+    }
+
+    /** @return the viewed blackboard: the main one if writable, the read one otherwise */
+    CParameterBlackboard *getBlackboard()
+    {
+        return mReader != nullptr ? mReader->getBlackboard()
+                                  : mParameterMgr.getParameterBlackboard();
+    }
+
+    CParameterMgr &mParameterMgr;
+    const CParameter &mParameter;
+    std::unique_ptr<CParameterMgr::CBlackboardReader> mReader;
+    CParameterMgr::CBlackboardLock mLock;
+};
+
+namespace
+{
+
+/** Decode all elements, their size being known at compile time */
+template <size_t size, class T, class Decode>
+void decodeAll(const uint8_t *data, size_t length, T values[], Decode decode)
+{
+    for (size_t index = 0; index < length; index++) {
+
+        uint32_t encoded = 0;
+
+        // Beware this code works on little endian architectures only!
+        memcpy(&encoded, data + index * size, size);
+        values[index] = decode(encoded);
+    }
+}
+
+/** Decode all elements with a typed kernel, instead of an element type call per element */
+template <class T, class Decode>
+void decodeAll(const ScalarCodec &codec, const uint8_t *data, size_t length, T values[],
+               Decode decode)
+{
+    switch (codec.size) {
+    case 1:
+        decodeAll<1>(data, length, values, decode);
+        break;
+    case 2:
+        decodeAll<2>(data, length, values, decode);
+        break;
+    default:
+        decodeAll<4>(data, length, values, decode);
+        break;
+    }
+}
+
+} // namespace
+
+ParameterArrayView::ParameterArrayView() = default;
+
+ParameterArrayView::ParameterArrayView(CParameterMgr &parameterMgr, const CParameter &parameter,
+                                       const ScalarCodec &codec, bool bWritable)
+    : mGuard(new Guard(parameterMgr, parameter, bWritable)),
+      mLength(parameter.getArrayLength()), mCodec(codec)
+{
+    CParameterBlackboard *pBlackboard = mGuard->getBlackboard();
+
+    // Writers modify the main blackboard through the returned location, readers must not
+    mData = bWritable ? pBlackboard->getLocation(parameter.getOffset())
+                      : static_cast<const CParameterBlackboard *>(pBlackboard)
+                            ->getLocation(parameter.getOffset());
+}
+
+ParameterArrayView::ParameterArrayView(ParameterArrayView &&other)
+    : mGuard(std::move(other.mGuard)), mData(other.mData), mLength(other.mLength),
+      mCodec(other.mCodec)
+{
+    other.mData = nullptr;
+    other.mLength = 0;
+}
+
+ParameterArrayView &ParameterArrayView::operator=(ParameterArrayView &&other)
+{
+    if (this == &other) {
+
+        return *this;
+    }
+    // Release the current view before taking the other one
+    mGuard.reset();
+    mGuard = std::move(other.mGuard);
+    mData = other.mData;
+    mLength = other.mLength;
+    mCodec = other.mCodec;
+    other.mData = nullptr;
+    other.mLength = 0;
+    return *this;
+}
+
+ParameterArrayView::~ParameterArrayView() = default;
+
+bool ParameterArrayView::isValid() const
+{
+    return mData != nullptr;
+}
+
+const void *ParameterArrayView::getData() const
+{
+    return mData;
+}
+
+size_t ParameterArrayView::getLength() const
+{
+    return mLength;
+}
+
+size_t ParameterArrayView::getStride() const
+{
+    return isValid() ? mCodec.size : 0;
+}
+
+bool ParameterArrayView::getAsIntegers(uint32_t values[]) const
+{
+    if (!isValid()) {
+
+        return false;
+    }
+    switch (mCodec.kind) {
+    case Kind::Boolean:
+        decodeAll(mCodec, mData, mLength, values, [](uint32_t data) -> uint32_t {
+            return data != 0;
+        });
+        return true;
+    case Kind::Integer:
+        decodeAll(mCodec, mData, mLength, values, [](uint32_t data) { return data; });
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool ParameterArrayView::getAsSignedIntegers(int32_t values[]) const
+{
+    if (!isValid() || mCodec.kind != Kind::Integer) {
+
+        return false;
+    }
+    size_t size = mCodec.size;
+
+    decodeAll(mCodec, mData, mLength, values,
+              [size](uint32_t data) { return signExtend(data, size); });
+    return true;
+}
+
+bool ParameterArrayView::getAsDoubles(double values[]) const
+{
+    if (!isValid()) {
+
+        return false;
+    }
+    const ScalarCodec &codec = mCodec;
+
+    switch (codec.kind) {
+    case Kind::Integer:
+        if (codec.adaptation == Adaptation::None) {
+
+            return false;
+        }
+        if (codec.isSigned) {
+
+            decodeAll(codec, mData, mLength, values, [&codec](uint32_t data) {
+                return toUserValue(codec, signExtend(data, codec.size));
+            });
+        } else {
+
+            decodeAll(codec, mData, mLength, values,
+                      [&codec](uint32_t data) { return toUserValue(codec, data); });
+        }
+        return true;
+    case Kind::FixedPoint:
+        decodeAll(codec, mData, mLength, values,
+                  [&codec](uint32_t data) { return fixedPointToUserValue(codec, data); });
+        return true;
+    case Kind::FloatingPoint:
+        decodeAll(codec, mData, mLength, values, &floatingPointToUserValue);
+        return true;
+    default:
+        return false;
+    }
+}
+
+WritableParameterArrayView::WritableParameterArrayView(CParameterMgr &parameterMgr,
+                                                       const CParameter &parameter,
+                                                       const ScalarCodec &codec)
+    : ParameterArrayView(parameterMgr, parameter, codec, true)
+{
+}
+
+WritableParameterArrayView &WritableParameterArrayView::operator=(
+    WritableParameterArrayView &&other)
+{
+    if (this == &other) {
+
+        return *this;
+    }
+    // Commit the current view before taking the other one
+    std::string error;
+    commit(error);
+
+    ParameterArrayView::operator=(std::move(other));
+    return *this;
+}
+
+WritableParameterArrayView::~WritableParameterArrayView()
+{
+    std::string error;
+    commit(error);
+}
+
+void *WritableParameterArrayView::getData()
+{
+    // Writable views are on the main blackboard, obtained as writable
+    return const_cast<uint8_t *>(mData);
+}
+
+bool WritableParameterArrayView::commit(std::string &error)
+{
+    if (!isValid()) {
+
+        error = "Can not commit an invalid array view.";
+        return false;
+    }
+    CParameterMgr &parameterMgr = mGuard->mParameterMgr;
+    const CParameter &parameter = mGuard->mParameter;
+    CParameterBlackboard *pBlackboard = parameterMgr.getParameterBlackboard();
+
+    // Writes through the view are not tracked by the blackboard
+    pBlackboard->markDirty(parameter.getOffset(), mLength * mCodec.size);
+
+    CParameterAccessContext parameterAccessContext(error, pBlackboard);
+    bool bSynchronized = parameter.sync(parameterAccessContext);
+
+    // The values are written whether synchronized or not, so publish them anyway
+    parameterMgr.publishBlackboardSnapshot();
+
+    mGuard.reset();
+    mData = nullptr;
+    mLength = 0;
+    return bSynchronized;
+}
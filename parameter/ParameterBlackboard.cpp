@@ -35,7 +35,28 @@
 // Size
 void CParameterBlackboard::setSize(size_t size)
 {
+    touch();
+
     mBlackboard.resize(size);
+
+    if (isDirtyTrackingEnabled()) {
+
+        // Lines follow the new size, all modified
+        setDirtyTrackingEnabled(true);
+    }
+}
+
+void CParameterBlackboard::release()
+{
+    touch();
+
+    // Unlike clear, swapping gives the memory back
+    Blackboard().swap(mBlackboard);
+
+    if (isDirtyTrackingEnabled()) {
+
+        setDirtyTrackingEnabled(true);
+    }
 }
 
 size_t CParameterBlackboard::getSize() const
@@ -46,6 +67,8 @@ size_t CParameterBlackboard::getSize() const
 // Single parameter access
 void CParameterBlackboard::writeInteger(const void *pvSrcData, size_t size, size_t offset)
 {
+    touch(offset, size);
+
     assertValidAccess(offset, size);
 
     auto first = MAKE_ARRAY_ITERATOR(static_cast<const uint8_t *>(pvSrcData), size);
@@ -68,6 +91,8 @@ void CParameterBlackboard::readInteger(void *pvDstData, size_t size, size_t offs
 
 void CParameterBlackboard::writeString(const std::string &input, size_t offset)
 {
+    touch(offset, input.size() + 1);
+
     assertValidAccess(offset, input.size() + 1);
 
     auto dest_last = std::copy(begin(input), end(input), atOffset(offset));
@@ -97,6 +122,8 @@ void CParameterBlackboard::readBuffer(void *pvDstData, size_t size, size_t offse
 // Element access
 void CParameterBlackboard::writeBytes(const std::vector<uint8_t> &bytes, size_t offset)
 {
+    touch(offset, bytes.size());
+
     assertValidAccess(offset, bytes.size());
 
     std::copy(begin(bytes), end(bytes), atOffset(offset));
@@ -111,6 +138,14 @@ void CParameterBlackboard::readBytes(std::vector<uint8_t> &bytes, size_t offset)
 
 // Access from/to subsystems
 uint8_t *CParameterBlackboard::getLocation(size_t offset)
+{
+    touch();
+
+    assertValidAccess(offset, 1);
+    return &mBlackboard[offset];
+}
+
+const uint8_t *CParameterBlackboard::getLocation(size_t offset) const
 {
     assertValidAccess(offset, 1);
     return &mBlackboard[offset];
@@ -120,6 +155,7 @@ uint8_t *CParameterBlackboard::getLocation(size_t offset)
 void CParameterBlackboard::restoreFrom(const CParameterBlackboard *pFromBlackboard, size_t offset)
 {
     const auto &fromBB = pFromBlackboard->mBlackboard;
+    touch(offset, fromBB.size());
     assertValidAccess(offset, fromBB.size());
     std::copy(begin(fromBB), end(fromBB), atOffset(offset));
 }
@@ -127,10 +163,169 @@ void CParameterBlackboard::restoreFrom(const CParameterBlackboard *pFromBlackboa
 void CParameterBlackboard::saveTo(CParameterBlackboard *pToBlackboard, size_t offset) const
 {
     auto &toBB = pToBlackboard->mBlackboard;
+    pToBlackboard->touch(0, toBB.size());
     assertValidAccess(offset, toBB.size());
     std::copy_n(atOffset(offset), toBB.size(), begin(toBB));
 }
 
+void CParameterBlackboard::restoreFrom(const CParameterBlackboard *pFromBlackboard, size_t offset,
+                                       const Range &range)
+{
+    touch(offset + range.first, range.second);
+
+    const auto &fromBB = pFromBlackboard->mBlackboard;
+    ALWAYS_ASSERT(range.first + range.second <= fromBB.size(),
+                  "Invalid range: offset=" << range.first << " size=" << range.second
+                                           << " reference size=" << fromBB.size());
+    assertValidAccess(offset + range.first, range.second);
+    std::copy_n(begin(fromBB) + range.first, range.second, atOffset(offset + range.first));
+}
+
+void CParameterBlackboard::gatherDifferences(const CParameterBlackboard &other,
+                                             Ranges &ranges) const
+{
+    // Identical bytes shorter than this between two differing ones are copied along
+    const size_t mergeGap = 8;
+
+    ALWAYS_ASSERT(getSize() == other.getSize(), "Comparing blackboards of different sizes: "
+                                                    << getSize() << " and " << other.getSize());
+    ranges.clear();
+
+    auto first = begin(mBlackboard);
+    auto last = end(mBlackboard);
+    auto otherFirst = begin(other.mBlackboard);
+
+    auto mismatch = std::mismatch(first, last, otherFirst);
+
+    while (mismatch.first != last) {
+
+        // Extend the range up to the next identical run long enough
+        auto rangeFirst = mismatch.first;
+        auto rangeLast = rangeFirst + 1;
+
+        for (auto it = rangeLast; it != last && size_t(it - rangeLast) < mergeGap; ++it) {
+
+            if (*it != *(otherFirst + (it - first))) {
+
+                rangeLast = it + 1;
+            }
+        }
+        ranges.emplace_back(rangeFirst - first, rangeLast - rangeFirst);
+
+        mismatch = std::mismatch(rangeLast, last, otherFirst + (rangeLast - first));
+    }
+}
+
+uint64_t CParameterBlackboard::getGeneration() const
+{
+    return mGeneration.load(std::memory_order_relaxed);
+}
+
+void CParameterBlackboard::setDirtyTrackingEnabled(bool bEnabled)
+{
+    if (!bEnabled) {
+
+        mLineGenerations.reset();
+        mLineCount = 0;
+        return;
+    }
+    mLineCount = (getSize() + dirtyLineSize - 1) / dirtyLineSize;
+    mLineGenerations.reset(new std::atomic<uint64_t>[mLineCount]);
+
+    // Everything may have been modified while not tracked
+    uint64_t generation = mGeneration.fetch_add(1, std::memory_order_relaxed) + 1;
+
+    for (size_t line = 0; line < mLineCount; line++) {
+
+        mLineGenerations[line].store(generation, std::memory_order_relaxed);
+    }
+}
+
+bool CParameterBlackboard::isDirtyTrackingEnabled() const
+{
+    return mLineGenerations != nullptr;
+}
+
+void CParameterBlackboard::markDirty(size_t offset, size_t size)
+{
+    assertValidAccess(offset, size);
+
+    touch(offset, size);
+}
+
+bool CParameterBlackboard::isDirtySince(size_t offset, size_t size, uint64_t generation) const
+{
+    if (!isDirtyTrackingEnabled()) {
+
+        return true;
+    }
+    assertValidAccess(offset, size);
+
+    for (size_t line = offset / dirtyLineSize; line * dirtyLineSize < offset + size; line++) {
+
+        if (mLineGenerations[line].load(std::memory_order_relaxed) > generation) {
+
+            return true;
+        }
+    }
+    return false;
+}
+
+void CParameterBlackboard::gatherDirtyRanges(size_t offset, size_t size, uint64_t generation,
+                                             Ranges &ranges) const
+{
+    ranges.clear();
+
+    if (!isDirtyTrackingEnabled()) {
+
+        ranges.emplace_back(offset, size);
+        return;
+    }
+    assertValidAccess(offset, size);
+
+    size_t end = offset + size;
+
+    for (size_t line = offset / dirtyLineSize; line * dirtyLineSize < end; line++) {
+
+        if (mLineGenerations[line].load(std::memory_order_relaxed) <= generation) {
+
+            continue;
+        }
+        // Clip the line to the range, extending the previous range if contiguous
+        size_t first = std::max(line * dirtyLineSize, offset);
+        size_t last = std::min((line + 1) * dirtyLineSize, end);
+
+        if (!ranges.empty() && ranges.back().first + ranges.back().second == first) {
+
+            ranges.back().second += last - first;
+        } else {
+
+            ranges.emplace_back(first, last - first);
+        }
+    }
+}
+
+void CParameterBlackboard::touch()
+{
+    mGeneration.fetch_add(1, std::memory_order_relaxed);
+}
+
+void CParameterBlackboard::touch(size_t offset, size_t size)
+{
+    uint64_t generation = mGeneration.fetch_add(1, std::memory_order_relaxed) + 1;
+
+    if (!isDirtyTrackingEnabled() || size == 0 || mLineCount == 0) {
+
+        return;
+    }
+    size_t lastLine = std::min((offset + size - 1) / dirtyLineSize, mLineCount - 1);
+
+    for (size_t line = offset / dirtyLineSize; line <= lastLine; line++) {
+
+        mLineGenerations[line].store(generation, std::memory_order_relaxed);
+    }
+}
+
 void CParameterBlackboard::assertValidAccess(size_t offset, size_t size) const
 {
     ALWAYS_ASSERT(offset + size <= getSize(),
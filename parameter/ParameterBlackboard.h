@@ -31,17 +31,27 @@
 
 #include "NonCopyable.hpp"
 
+#include <atomic>
 #include <cstdint>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 class CParameterBlackboard : private utility::NonCopyable
 {
 public:
+    /** Byte range, as offset and size */
+    using Range = std::pair<size_t, size_t>;
+    using Ranges = std::vector<Range>;
+
     // Size
     void setSize(size_t size);
     size_t getSize() const;
 
+    /** Free the storage, the blackboard being empty until sized again */
+    void release();
+
     // Single parameter access
     void writeInteger(const void *pvSrcData, size_t size, size_t offset);
     void readInteger(void *pvDstData, size_t size, size_t offset) const;
@@ -82,19 +92,98 @@ public:
      */
     void readBytes(std::vector<uint8_t> &bytes, size_t offset) const;
 
-    // Access from/to subsystems
+    /** Access from/to subsystems
+     *
+     * Writes through the returned location are not tracked as modifications of the range.
+     */
     uint8_t *getLocation(size_t offset);
 
+    /** Read only access, for views on the blackboard content */
+    const uint8_t *getLocation(size_t offset) const;
+
     // Configuration handling
     void restoreFrom(const CParameterBlackboard *pFromBlackboard, size_t offset);
     void saveTo(CParameterBlackboard *pToBlackboard, size_t offset) const;
 
+    /** Restore a range of another blackboard
+     *
+     * @param[in] pFromBlackboard the blackboard to copy from
+     * @param[in] offset the offset of pFromBlackboard content in this blackboard
+     * @param[in] range the range to copy, relative to pFromBlackboard
+     */
+    void restoreFrom(const CParameterBlackboard *pFromBlackboard, size_t offset,
+                     const Range &range);
+
+    /** Gather the byte ranges differing from another blackboard of the same size
+     *
+     * Close ranges are merged, as copying a few identical bytes is cheaper than splitting a copy.
+     *
+     * @param[in] other the blackboard to compare with
+     * @param[out] ranges the differing ranges, in increasing offset order
+     */
+    void gatherDifferences(const CParameterBlackboard &other, Ranges &ranges) const;
+
+    /** Modification count
+     *
+     * Increased by each write access (including through getLocation), so that users can detect
+     * the blackboard was modified since a previous call.
+     */
+    uint64_t getGeneration() const;
+
+    /** Enable or disable the tracking of modified ranges
+     *
+     * When enabling, the whole blackboard is considered modified. Tracking state is reallocated:
+     * no write may happen concurrently.
+     *
+     * @param[in] bEnabled true to track modified ranges
+     */
+    void setDirtyTrackingEnabled(bool bEnabled);
+    bool isDirtyTrackingEnabled() const;
+
+    /** Consider a range as modified */
+    void markDirty(size_t offset, size_t size);
+
+    /** Was a range modified since a given generation
+     *
+     * Modifications are tracked per line of dirtyLineSize bytes, so a range sharing a line with
+     * a modified one is considered modified as well.
+     *
+     * @param[in] offset the range offset
+     * @param[in] size the range size
+     * @param[in] generation the generation, as returned by getGeneration
+     * @return true if the range was modified since, always true when tracking is disabled
+     */
+    bool isDirtySince(size_t offset, size_t size, uint64_t generation) const;
+
+    /** Gather the sub-ranges of a range modified since a given generation
+     *
+     * @param[in] offset the range offset
+     * @param[in] size the range size
+     * @param[in] generation the generation, as returned by getGeneration
+     * @param[out] ranges the modified sub-ranges, the whole range when tracking is disabled
+     */
+    void gatherDirtyRanges(size_t offset, size_t size, uint64_t generation, Ranges &ranges) const;
+
+    /** Granularity of the modified ranges tracking, in bytes */
+    static const size_t dirtyLineSize = 64;
+
 private:
+    /** Count a modification, of given range if any */
+    void touch();
+    void touch(size_t offset, size_t size);
+
     void assertValidAccess(size_t offset, size_t size) const;
 
     using Blackboard = std::vector<uint8_t>;
     Blackboard mBlackboard;
 
+    /** Modification count, written concurrently when domains are applied in parallel */
+    std::atomic<uint64_t> mGeneration{0};
+
+    /** Generation of the last modification of each line, null when tracking is disabled */
+    std::unique_ptr<std::atomic<uint64_t>[]> mLineGenerations;
+    size_t mLineCount{0};
+
     Blackboard::iterator atOffset(size_t offset) { return begin(mBlackboard) + offset; }
     Blackboard::const_iterator atOffset(size_t offset) const { return begin(mBlackboard) + offset; }
 };
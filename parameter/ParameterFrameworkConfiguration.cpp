@@ -59,6 +59,36 @@ uint16_t CParameterFrameworkConfiguration::getServerPort() const
     return _uiServerPort;
 }
 
+// Number of threads applying domains
+uint32_t CParameterFrameworkConfiguration::getApplyThreadCount() const
+{
+    return _uiApplyThreadCount;
+}
+
+// Number of threads synchronizing subsystems
+uint32_t CParameterFrameworkConfiguration::getSyncThreadCount() const
+{
+    return _uiSyncThreadCount;
+}
+
+// Number of threads parsing structure and settings files
+uint32_t CParameterFrameworkConfiguration::getLoadThreadCount() const
+{
+    return _uiLoadThreadCount;
+}
+
+// Domain configuration settings decoded when first used
+bool CParameterFrameworkConfiguration::isLazySettings() const
+{
+    return _bLazySettings;
+}
+
+// Maximum number of decoded lazy configurations per domain
+uint32_t CParameterFrameworkConfiguration::getLazySettingsCacheSize() const
+{
+    return _uiLazySettingsCacheSize;
+}
+
 // From IXmlSink
 bool CParameterFrameworkConfiguration::fromXml(const CXmlElement &xmlElement,
                                                CXmlSerializingContext &serializingContext)
@@ -72,6 +102,19 @@ bool CParameterFrameworkConfiguration::fromXml(const CXmlElement &xmlElement,
     // Server port
     xmlElement.getAttribute("ServerPort", _uiServerPort);
 
+    // Number of threads applying domains (optional)
+    xmlElement.getAttribute("ApplyThreadCount", _uiApplyThreadCount);
+
+    // Number of threads synchronizing subsystems (optional)
+    xmlElement.getAttribute("SyncThreadCount", _uiSyncThreadCount);
+
+    // Number of threads parsing structure and settings files (optional)
+    xmlElement.getAttribute("LoadThreadCount", _uiLoadThreadCount);
+
+    // Lazy settings (optional)
+    xmlElement.getAttribute("LazySettings", _bLazySettings);
+    xmlElement.getAttribute("LazySettingsCacheSize", _uiLazySettingsCacheSize);
+
     // Base
     return base::fromXml(xmlElement, serializingContext);
 }
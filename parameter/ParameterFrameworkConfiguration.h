@@ -45,6 +45,21 @@ public:
     // Server port
     uint16_t getServerPort() const;
 
+    // Number of threads applying domains, 0 or 1 for none
+    uint32_t getApplyThreadCount() const;
+
+    // Number of threads synchronizing subsystems, 0 or 1 for none
+    uint32_t getSyncThreadCount() const;
+
+    // Number of threads parsing structure and settings files, 0 or 1 for none
+    uint32_t getLoadThreadCount() const;
+
+    // Domain configuration settings read from a domains bundle decoded when first used
+    bool isLazySettings() const;
+
+    // Maximum number of decoded lazy configurations per domain, 0 for no limit
+    uint32_t getLazySettingsCacheSize() const;
+
     // From IXmlSink
     bool fromXml(const CXmlElement &xmlElement,
                  CXmlSerializingContext &serializingContext) override;
@@ -59,4 +74,13 @@ private:
     bool _bTuningAllowed{false};
     // Server port
     uint16_t _uiServerPort{0};
+    // Number of threads applying domains
+    uint32_t _uiApplyThreadCount{0};
+    // Number of threads synchronizing subsystems
+    uint32_t _uiSyncThreadCount{0};
+    // Number of threads parsing structure and settings files
+    uint32_t _uiLoadThreadCount{0};
+    // Lazy settings
+    bool _bLazySettings{false};
+    uint32_t _uiLazySettingsCacheSize{0};
 };
@@ -63,6 +63,8 @@
 #include "XmlDomainSerializingContext.h"
 #include "XmlDomainExportContext.h"
 #include "XmlDomainImportContext.h"
+#include "DomainsBundle.h"
+#include "StructureCache.h"
 #include "BitParameterBlockType.h"
 #include "BitParameterType.h"
 #include "StringParameterType.h"
@@ -82,10 +84,14 @@
 #include "XmlStreamDocSink.h"
 #include "XmlMemoryDocSink.h"
 #include "XmlDocSource.h"
+#include "XmlDocLoader.h"
 #include "XmlMemoryDocSource.h"
 #include "SelectionCriteriaDefinition.h"
 #include "Utility.h"
 #include "Memory.hpp"
+#include "ThreadPool.hpp"
+#include "LatencyHistogram.hpp"
+#include "MappedFile.hpp"
 #include <sstream>
 #include <fstream>
 #include <algorithm>
@@ -178,6 +184,40 @@ const CParameterMgr::SRemoteCommandParserItem CParameterMgr::gastRemoteCommandPa
     {"sync", &CParameterMgr::syncCommandProcess, 0, "",
      "Synchronize current settings to hardware while in Tuning Mode and Auto Sync off"},
 
+    /// Decision cache
+    {"setDecisionCache", &CParameterMgr::setDecisionCacheCommandProcess, 1, "on|off*",
+     "Turn on or off memoization of the applicable configuration of each domain"},
+    {"getDecisionCache", &CParameterMgr::getDecisionCacheCommandProcess, 0, "",
+     "Show Decision Cache state"},
+    {"getDecisionCacheStatistics", &CParameterMgr::getDecisionCacheStatisticsCommandProcess, 0, "",
+     "Show Decision Cache hits and misses of each domain"},
+
+    /// Dirty tracking
+    {"setDirtyTracking", &CParameterMgr::setDirtyTrackingCommandProcess, 1, "on|off*",
+     "Turn on or off skipping the synchronization of unmodified subsystem objects"},
+    {"getDirtyTracking", &CParameterMgr::getDirtyTrackingCommandProcess, 0, "",
+     "Show Dirty Tracking state"},
+    {"getSyncStatistics", &CParameterMgr::getSyncStatisticsCommandProcess, 0, "",
+     "Show performed and skipped synchronizations of each subsystem"},
+
+    /// Apply statistics
+    {"setApplyStatistics", &CParameterMgr::setApplyStatisticsCommandProcess, 1, "on|off*",
+     "Turn on or off recording of application latencies"},
+    {"getApplyStatistics", &CParameterMgr::getApplyStatisticsCommandProcess, 0, "",
+     "Show latencies of applications, of each domain and of each subsystem"},
+    {"resetApplyStatistics", &CParameterMgr::resetApplyStatisticsCommandProcess, 0, "",
+     "Forget recorded application latencies"},
+
+    /// Startup profile
+    {"getStartupProfile", &CParameterMgr::getStartupProfileCommandProcess, 0, "",
+     "Show durations and heap growth of the start phases, in JSON"},
+
+    /// Path index
+    {"getPathIndexStatistics", &CParameterMgr::getPathIndexStatisticsCommandProcess, 0, "",
+     "Show size and hit rate of the path index"},
+    {"resetPathIndexStatistics", &CParameterMgr::resetPathIndexStatisticsCommandProcess, 0, "",
+     "Forget path index hits and misses"},
+
     /// Criteria
     {"listCriteria", &CParameterMgr::listCriteriaCommandProcess, 0, "[CSV|XML]",
      "List selection criteria"},
@@ -326,7 +366,8 @@ const CParameterMgr::SRemoteCommandParserItem CParameterMgr::gastRemoteCommandPa
 CParameterMgr::CParameterMgr(const string &strConfigurationFilePath, log::ILogger &logger)
     : _pMainParameterBlackboard(new CParameterBlackboard),
       _pElementLibrarySet(new CElementLibrarySet),
-      _xmlConfigurationUri(CXmlDocSource::mkUri(strConfigurationFilePath, "")), _logger(logger)
+      _xmlConfigurationUri(CXmlDocSource::mkUri(strConfigurationFilePath, "")), _logger(logger),
+      _applyLatency(new utility::LatencyHistogram)
 {
     // Deal with children
     addChild(new CParameterFrameworkConfiguration);
@@ -337,6 +378,8 @@ CParameterMgr::CParameterMgr(const string &strConfigurationFilePath, log::ILogge
 
 CParameterMgr::~CParameterMgr()
 {
+    stopApplyThread();
+
     // Children
     delete _pRemoteProcessorServer;
     delete _pMainParameterBlackboard;
@@ -358,49 +401,94 @@ bool CParameterMgr::load(string &strError)
 {
     LOG_CONTEXT("Loading");
 
+    _startupProfile.clear();
+
     feedElementLibraries();
 
     // Load Framework configuration
-    if (!loadFrameworkConfiguration(strError)) {
+    {
+        CStartupProfile::CPhase phase(_startupProfile, "configuration");
 
-        return false;
+        if (!loadFrameworkConfiguration(strError)) {
+
+            return false;
+        }
     }
+    {
+        CStartupProfile::CPhase phase(_startupProfile, "plugins");
 
-    if (!loadSubsystems(strError)) {
+        if (!loadSubsystems(strError)) {
 
-        return false;
+            return false;
+        }
     }
 
     // Load structure
-    if (!loadStructure(strError)) {
+    {
+        CStartupProfile::CPhase phase(_startupProfile, "structure");
 
-        return false;
+        if (!loadStructure(strError)) {
+
+            return false;
+        }
     }
 
+    // Propagate latency recording to the loaded subsystems
+    setApplyStatistics(_bApplyStatisticsOn);
+
     // Load settings
-    if (!loadSettings(strError)) {
+    {
+        CStartupProfile::CPhase phase(_startupProfile, "settings");
 
-        return false;
+        if (!loadSettings(strError)) {
+
+            return false;
+        }
     }
 
+    // Files are all parsed
+    _loadThreadPool.reset();
+
     // Init flow of element tree
-    if (!init(strError)) {
+    {
+        CStartupProfile::CPhase phase(_startupProfile, "init");
 
-        return false;
+        if (!init(strError)) {
+
+            return false;
+        }
     }
 
     {
         LOG_CONTEXT("Main blackboard back synchronization");
+        CStartupProfile::CPhase phase(_startupProfile, "backSynchronization");
+
+        // Back synchronization for areas in parameter blackboard not covered by any domain,
+        // subsystem per subsystem to time each one
+        const CSystemClass *pSystemClass = getConstSystemClass();
+
+        for (size_t child = 0; child < pSystemClass->getNbChildren(); child++) {
+
+            auto *pSubsystem = static_cast<const CSubsystem *>(pSystemClass->getChild(child));
+            auto start = std::chrono::steady_clock::now();
 
-        // Back synchronization for areas in parameter blackboard not covered by any domain
-        BackSynchronizer(getConstSystemClass(), _pMainParameterBlackboard).sync();
+            BackSynchronizer(pSubsystem, _pMainParameterBlackboard).sync();
+
+            _startupProfile.addDetail("subsystems", pSubsystem->getName(),
+                                      std::chrono::duration_cast<CStartupProfile::Duration>(
+                                          std::chrono::steady_clock::now() - start));
+        }
     }
 
     // We're done loading the settings and back synchronizing
     CConfigurableDomains *pConfigurableDomains = getConfigurableDomains();
 
     // We need to ensure all domains are valid
-    pConfigurableDomains->validate(_pMainParameterBlackboard);
+    {
+        CStartupProfile::CPhase phase(_startupProfile, "validation");
+
+        pConfigurableDomains->validate(_pMainParameterBlackboard);
+    }
 
     // Log selection criterion states
     {
@@ -418,7 +506,11 @@ bool CParameterMgr::load(string &strError)
     getSystemClass()->cleanSubsystemsNeedToResync();
 
     // At initialization, check subsystems that need resync
-    doApplyConfigurations(true);
+    {
+        CStartupProfile::CPhase phase(_startupProfile, "apply");
+
+        doApplyConfigurations(true);
+    }
 
     // Start remote processor server if appropriate
     return handleRemoteProcessingInterface(strError);
@@ -461,6 +553,53 @@ bool CParameterMgr::loadFrameworkConfiguration(string &strError)
     info() << "Tuning "
            << (getConstFrameworkConfiguration()->isTuningAllowed() ? "allowed" : "prohibited");
 
+    // Concurrent domain application, the client setting prevails
+    size_t applyThreadCount = _applyThreadCount != 0
+                                  ? _applyThreadCount
+                                  : getConstFrameworkConfiguration()->getApplyThreadCount();
+
+    if (applyThreadCount > 1) {
+
+        _applyThreadPool.reset(new utility::ThreadPool(applyThreadCount));
+
+        info() << "Applying domains with " << applyThreadCount << " threads";
+    } else {
+
+        _applyThreadPool.reset();
+    }
+    getConfigurableDomains()->setThreadPool(_applyThreadPool.get());
+
+    // Concurrent subsystem synchronization, the client setting prevails
+    size_t syncThreadCount = _syncThreadCount != 0
+                                 ? _syncThreadCount
+                                 : getConstFrameworkConfiguration()->getSyncThreadCount();
+
+    if (syncThreadCount > 1) {
+
+        _syncThreadPool.reset(new utility::ThreadPool(syncThreadCount));
+
+        info() << "Synchronizing subsystems with " << syncThreadCount << " threads";
+    } else {
+
+        _syncThreadPool.reset();
+    }
+    getConfigurableDomains()->setSyncThreadPool(_syncThreadPool.get());
+
+    // Concurrent file parsing, the client setting prevails
+    size_t loadThreadCount = _loadThreadCount != 0
+                                 ? _loadThreadCount
+                                 : getConstFrameworkConfiguration()->getLoadThreadCount();
+
+    if (loadThreadCount > 1) {
+
+        _loadThreadPool.reset(new utility::ThreadPool(loadThreadCount));
+
+        info() << "Parsing files with " << loadThreadCount << " threads";
+    } else {
+
+        _loadThreadPool.reset();
+    }
+
     return true;
 }
 
@@ -472,6 +611,11 @@ bool CParameterMgr::loadSubsystems(std::string &error)
     bool isSuccess =
         getSystemClass()->loadSubsystems(error, _pSubsystemPlugins, !_bFailOnMissingSubsystem);
 
+    for (const auto &loadTime : getConstSystemClass()->getPluginLoadTimes()) {
+
+        _startupProfile.addDetail("plugins", loadTime.plugin, loadTime.duration);
+    }
+
     if (isSuccess) {
         info() << "All subsystem plugins successfully loaded";
 
@@ -509,6 +653,10 @@ bool CParameterMgr::loadStructure(string &strError)
     CParameterAccessContext accessContext(strError);
     CXmlParameterSerializingContext parameterBuildContext(accessContext, strError);
 
+    // Subsystem files are parsed along with the structure file
+    CXmlDocLoader docLoader(_loadThreadPool.get(), "SubsystemInclude");
+    parameterBuildContext.setDocLoader(&docLoader);
+
     {
         // Get structure URI
         string structureUri =
@@ -516,16 +664,67 @@ bool CParameterMgr::loadStructure(string &strError)
 
         LOG_CONTEXT("Importing system structure from file " + structureUri);
 
-        _xmlDoc *doc = CXmlDocSource::mkXmlDoc(structureUri, true, true, parameterBuildContext);
+        // Get structure cache element (optional)
+        const CFrameworkConfigurationLocation *pStructureCacheFileLocation =
+            static_cast<const CFrameworkConfigurationLocation *>(
+                getConstFrameworkConfiguration()->findChildOfKind("StructureCacheFileLocation"));
+
+        std::unique_ptr<CStructureCache> cache;
+        _xmlDoc *doc = nullptr;
+
+        if (pStructureCacheFileLocation) {
+
+            string cachePath = CXmlDocSource::mkPath(CXmlDocSource::mkUri(
+                _xmlConfigurationUri, pStructureCacheFileLocation->getUri()));
+
+            cache.reset(new CStructureCache(cachePath, structureUri));
+
+            string strCacheError;
+            doc = cache->load(_bValidateSchemasOnStart, strCacheError);
+
+            if (doc != nullptr) {
+
+                info() << "Structure description read from cache " << cachePath;
+            } else {
+
+                info() << "Structure cache " << cachePath << " not used: " << strCacheError;
+            }
+        }
+        // A cached document has already been validated
+        bool bFromCache = doc != nullptr;
+
+        if (!bFromCache) {
+            // Parse through the cache, if any, so that it can be rebuilt
+            doc = cache ? cache->parse(parameterBuildContext)
+                        : CXmlDocSource::mkXmlDoc(structureUri, true, true, parameterBuildContext);
+        }
         if (doc == nullptr) {
             return false;
         }
 
         if (!xmlParse(parameterBuildContext, pSystemClass, doc, structureUri,
-                      EParameterCreationLibrary)) {
+                      EParameterCreationLibrary, true, "Name", !bFromCache)) {
 
             return false;
         }
+        logParseTimes(docLoader);
+
+        for (size_t child = 0; child < pSystemClass->getNbChildren(); child++) {
+
+            auto *pSubsystem = static_cast<const CSubsystem *>(pSystemClass->getChild(child));
+            _startupProfile.addDetail("mapping", pSubsystem->getName(),
+                                      pSubsystem->getMappingDuration());
+        }
+
+        if (cache && !bFromCache) {
+
+            string strCacheError;
+
+            if (!cache->store(_bValidateSchemasOnStart, strCacheError)) {
+
+                warning() << "Could not store the structure cache: " << strCacheError;
+            }
+        }
     }
 
     // Initialize offsets
@@ -534,6 +733,9 @@ bool CParameterMgr::loadStructure(string &strError)
     // Initialize main blackboard's size
     _pMainParameterBlackboard->setSize(pSystemClass->getFootPrint());
 
+    // Index elements by path, the structure does not change anymore
+    _pathIndex.build(*pSystemClass);
+
     return true;
 }
 
@@ -579,6 +781,31 @@ bool CParameterMgr::loadSettingsFromConfigFile(string &strError)
         static_cast<const CFrameworkConfigurationLocation *>(
             pParameterConfigurationGroup->findChildOfKind("ConfigurableDomainsFileLocation"));
 
+    // Prefer the compiled domains bundle, if any
+    const CFrameworkConfigurationLocation *pConfigurableDomainsBundleFileLocation =
+        static_cast<const CFrameworkConfigurationLocation *>(
+            pParameterConfigurationGroup->findChildOfKind("ConfigurableDomainsBundleFileLocation"));
+
+    if (pConfigurableDomainsBundleFileLocation) {
+
+        string strBundleError;
+
+        if (importDomainsBundle(CXmlDocSource::mkUri(
+                                    _xmlConfigurationUri,
+                                    pConfigurableDomainsBundleFileLocation->getUri()),
+                                strBundleError)) {
+
+            return true;
+        }
+        if (!pConfigurableDomainsFileLocation) {
+
+            strError = strBundleError;
+            return false;
+        }
+        warning() << strBundleError;
+        warning() << "Falling back to the configurable domains XML file";
+    }
+
     if (!pConfigurableDomainsFileLocation) {
 
         strError = "No ConfigurableDomainsFileLocation element found for SystemClass " +
@@ -603,6 +830,9 @@ bool CParameterMgr::loadSettingsFromConfigFile(string &strError)
     // Auto validation of configurations
     xmlDomainImportContext.setAutoValidationRequired(true);
 
+    CXmlDocLoader docLoader(_loadThreadPool.get());
+    xmlDomainImportContext.setDocLoader(&docLoader);
+
     info() << "Importing configurable domains from file " << configurationDomainsUri
            << " with settings";
 
@@ -612,20 +842,82 @@ bool CParameterMgr::loadSettingsFromConfigFile(string &strError)
         return false;
     }
 
-    return xmlParse(xmlDomainImportContext, pConfigurableDomains, doc, _xmlConfigurationUri,
-                    EParameterConfigurationLibrary, true, "SystemClassName");
+    if (!xmlParse(xmlDomainImportContext, pConfigurableDomains, doc, _xmlConfigurationUri,
+                  EParameterConfigurationLibrary, true, "SystemClassName")) {
+
+        return false;
+    }
+    logParseTimes(docLoader);
+
+    return true;
+}
+
+void CParameterMgr::logParseTimes(const CXmlDocLoader &docLoader)
+{
+    LOG_CONTEXT("File parse times");
+
+    for (const auto &parseTime : docLoader.getParseTimes()) {
+
+        info() << parseTime.uri << ": " << parseTime.duration.count() << " us";
+        _startupProfile.addDetail("files", parseTime.uri, parseTime.duration);
+    }
+}
+
+bool CParameterMgr::importDomainsBundle(const string &bundleUri, string &strError)
+{
+    info() << "Importing configurable domains from bundle " << bundleUri;
+
+    string bundlePath = CXmlDocSource::mkPath(bundleUri);
+
+    if (bundlePath.empty()) {
+
+        strError = "Domains bundle " + bundleUri + " is not a local file";
+        return false;
+    }
+    CConfigurableDomains *pConfigurableDomains = getConfigurableDomains();
+
+    try {
+        // Shared with lazy settings, which refer to the mapping
+        auto bundle = std::make_shared<MappedFile>(bundlePath);
+
+        CDomainsBundleReader reader(bundle->getData(), bundle->getSize(), *getSystemClass(),
+                                    getConstSelectionCriteria()->getSelectionCriteriaDefinition(),
+                                    strError);
+
+        if (getConstFrameworkConfiguration()->isLazySettings()) {
+
+            reader.setLazySettings(bundle,
+                                   getConstFrameworkConfiguration()->getLazySettingsCacheSize());
+        }
+
+        if (reader.readHeader() && pConfigurableDomains->fromBundle(reader) &&
+            (reader.atEnd() || reader.fail("Unexpected data at the end of the domains bundle"))) {
+
+            return true;
+        }
+    } catch (std::runtime_error &e) {
+
+        strError = e.what();
+    }
+    strError = "Could not import domains bundle " + bundlePath + ": " + strError;
+
+    // Start clean
+    pConfigurableDomains->clean();
+
+    return false;
 }
 
 // XML parsing
 bool CParameterMgr::xmlParse(CXmlElementSerializingContext &elementSerializingContext,
                              CElement *pRootElement, _xmlDoc *doc, const string &baseUri,
                              CParameterMgr::ElementLibrary eElementLibrary, bool replace,
-                             const string &strNameAttributeName)
+                             const string &strNameAttributeName, bool bValidate)
 {
     // Init serializing context
     elementSerializingContext.set(_pElementLibrarySet->getElementLibrary(eElementLibrary), baseUri);
 
-    CXmlDocSource docSource(doc, _bValidateSchemasOnStart, pRootElement->getXmlElementName(),
+    CXmlDocSource docSource(doc, bValidate && _bValidateSchemasOnStart,
+                            pRootElement->getXmlElementName(),
                             pRootElement->getName(), strNameAttributeName);
 
     docSource.setSchemaBaseUri(getSchemaUri());
@@ -682,7 +974,41 @@ void CParameterMgr::applyConfigurations()
     LOG_CONTEXT("Configuration application request");
 
     // Lock state
-    lock_guard<mutex> autoLock(getBlackboardMutex());
+    CBlackboardLock autoLock(*this);
+
+    if (!_bTuningModeIsOn) {
+
+        // Apply configuration(s)
+        doApplyConfigurations(false);
+    } else {
+
+        warning() << "Configurations were not applied because the TuningMode is on";
+    }
+}
+
+void CParameterMgr::applyCriteriaTransaction(const CriteriaTransaction &transaction)
+{
+    LOG_CONTEXT("Criteria transaction");
+
+    // Lock state
+    CBlackboardLock autoLock(*this);
+
+    // Publish all states, then log the changed ones at once
+    std::string strChanges;
+
+    for (const auto &criterionState : transaction.getStates()) {
+
+        auto *pSelectionCriterion = static_cast<CSelectionCriterion *>(criterionState.first);
+
+        if (pSelectionCriterion->updateCriterionState(criterionState.second)) {
+
+            strChanges += "\n" + pSelectionCriterion->getFormattedDescription(false, false);
+        }
+    }
+    if (!strChanges.empty()) {
+
+        info() << "Selection criteria changed event:" << strChanges;
+    }
 
     if (!_bTuningModeIsOn) {
 
@@ -694,9 +1020,89 @@ void CParameterMgr::applyConfigurations()
     }
 }
 
+void CParameterMgr::applyConfigurationsAsync(ApplyCallback callback)
+{
+    lock_guard<mutex> requestLock(_applyRequestMutex);
+
+    if (!_applyThread.joinable()) {
+
+        _applyThread = std::thread(&CParameterMgr::applyThreadMain, this);
+    }
+    _pendingApplyCallbacks.push_back(std::move(callback));
+    _bApplyRequested = true;
+
+    _applyRequestCondition.notify_one();
+}
+
+void CParameterMgr::applyThreadMain()
+{
+    std::unique_lock<mutex> requestLock(_applyRequestMutex);
+
+    while (true) {
+
+        _applyRequestCondition.wait(requestLock,
+                                    [this] { return _bApplyRequested || _bStopApplyThread; });
+
+        if (!_bApplyRequested) {
+
+            return;
+        }
+        // Serve all requests made so far with a single application
+        std::vector<ApplyCallback> callbacks;
+        callbacks.swap(_pendingApplyCallbacks);
+        _bApplyRequested = false;
+
+        requestLock.unlock();
+
+        ApplyReport report;
+        {
+            LOG_CONTEXT("Asynchronous configuration application request");
+
+            CBlackboardLock autoLock(*this);
+
+            if (!_bTuningModeIsOn) {
+
+                doApplyConfigurations(false, &report);
+            } else {
+
+                warning() << "Configurations were not applied because the TuningMode is on";
+            }
+        }
+        for (const auto &callback : callbacks) {
+
+            if (callback) {
+
+                callback(report);
+            }
+        }
+        requestLock.lock();
+    }
+}
+
+void CParameterMgr::stopApplyThread()
+{
+    {
+        lock_guard<mutex> requestLock(_applyRequestMutex);
+
+        _bStopApplyThread = true;
+        _applyRequestCondition.notify_one();
+    }
+    if (_applyThread.joinable()) {
+
+        _applyThread.join();
+    }
+}
+
 const CConfigurableElement *CParameterMgr::getConfigurableElement(const string &strPath,
                                                                   string &strError) const
 {
+    const CConfigurableElement *pIndexedElement = _pathIndex.find(strPath);
+
+    if (pIndexedElement) {
+
+        return pIndexedElement;
+    }
+
     CPathNavigator pathNavigator(strPath);
 
     // Nagivate through system class
@@ -781,6 +1187,11 @@ ElementHandle *CParameterMgr::createElementHandle(const std::string &path, std::
     return new ElementHandle(*pConfigurableElement, *this);
 }
 
+ParameterTransaction *CParameterMgr::createParameterTransaction()
+{
+    return new ParameterTransaction(*this);
+}
+
 void CParameterMgr::getSettingsAsBytes(const CConfigurableElement &element,
                                        std::vector<uint8_t> &settings) const
 {
@@ -791,8 +1202,9 @@ void CParameterMgr::getSettingsAsBytes(const CConfigurableElement &element,
 
     // Prepare parameter access context for main blackboard.
     // No need to handle output raw format and value space as Byte arrays are hexa formatted
+    CBlackboardReader reader(*this, &element);
     CParameterAccessContext parameterAccessContext(error);
-    parameterAccessContext.setParameterBlackboard(_pMainParameterBlackboard);
+    parameterAccessContext.setParameterBlackboard(reader.getBlackboard());
 
     // Get the settings
     element.getSettingsAsBytes(settings, parameterAccessContext);
@@ -812,8 +1224,17 @@ bool CParameterMgr::setSettingsAsBytes(const CConfigurableElement &element,
     parameterAccessContext.setParameterBlackboard(_pMainParameterBlackboard);
     parameterAccessContext.setAutoSync(autoSyncOn());
 
+    // Ensure we're safe against blackboard foreign access
+    CBlackboardLock autoLock(*this, &element);
+
     // Set the settings
-    return element.setSettingsAsBytes(settings, parameterAccessContext);
+    if (!element.setSettingsAsBytes(settings, parameterAccessContext)) {
+
+        return false;
+    }
+    publishBlackboardSnapshot();
+
+    return true;
 }
 
 void CParameterMgr::setFailureOnMissingSubsystem(bool bFail)
@@ -836,6 +1257,46 @@ bool CParameterMgr::getFailureOnFailedSettingsLoad() const
     return _bFailOnFailedSettingsLoad;
 }
 
+void CParameterMgr::setApplyThreadCount(size_t threadCount)
+{
+    _applyThreadCount = threadCount;
+}
+
+size_t CParameterMgr::getApplyThreadCount() const
+{
+    return _applyThreadCount;
+}
+
+void CParameterMgr::setSyncThreadCount(size_t threadCount)
+{
+    _syncThreadCount = threadCount;
+}
+
+size_t CParameterMgr::getSyncThreadCount() const
+{
+    return _syncThreadCount;
+}
+
+void CParameterMgr::setLoadThreadCount(size_t threadCount)
+{
+    _loadThreadCount = threadCount;
+}
+
+size_t CParameterMgr::getLoadThreadCount() const
+{
+    return _loadThreadCount;
+}
+
+void CParameterMgr::setLockSharding(bool bEnabled)
+{
+    _bLockSharding = bEnabled;
+}
+
+bool CParameterMgr::isLockShardingEnabled() const
+{
+    return _bLockSharding;
+}
+
 const string &CParameterMgr::getSchemaUri() const
 {
     return _schemaUri;
@@ -902,6 +1363,24 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::statusCommandProces
     strResult += autoSyncOn() ? "on" : "off";
     strResult += "\n";
 
+    // Decision cache
+    strResult += "Decision Cache: ";
+    strResult += decisionCacheOn() ? "on" : "off";
+    strResult += "\n";
+
+    // Dirty tracking
+    strResult += "Dirty Tracking: ";
+    strResult += dirtyTrackingOn() ? "on" : "off";
+    strResult += "\n";
+
+    // Apply statistics
+    strResult += "Apply Statistics: ";
+    strResult += applyStatisticsOn() ? "on" : "off";
+    strResult += "\n";
+
+    // Path index
+    strResult += "Path Index: " + formatPathIndexStatistics() + "\n";
+
     /// Subsystem list
     utility::appendTitle(strResult, "Subsystems:");
     string strSubsystemList;
@@ -1054,6 +1533,167 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::syncCommandProcess(
     return sync(strResult) ? CCommandHandler::EDone : CCommandHandler::EFailed;
 }
 
+/// Decision cache
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::setDecisionCacheCommandProcess(
+    const IRemoteCommand &remoteCommand, string & /*strResult*/)
+{
+    if (remoteCommand.getArgument(0) == "on") {
+
+        setDecisionCache(true);
+    } else if (remoteCommand.getArgument(0) == "off") {
+
+        setDecisionCache(false);
+    } else {
+        // Show usage
+        return CCommandHandler::EShowUsage;
+    }
+    return CCommandHandler::EDone;
+}
+
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getDecisionCacheCommandProcess(
+    const IRemoteCommand & /*command*/, string &strResult)
+{
+    strResult = decisionCacheOn() ? "on" : "off";
+
+    return CCommandHandler::ESucceeded;
+}
+
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::
+    getDecisionCacheStatisticsCommandProcess(const IRemoteCommand & /*command*/,
+                                             string &strResult)
+{
+    // Statistics are updated by applications
+    CBlackboardLock autoLock(*this);
+
+    getConfigurableDomains()->listDecisionCacheStatistics(strResult);
+
+    return CCommandHandler::ESucceeded;
+}
+
+/// Dirty tracking
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::setDirtyTrackingCommandProcess(
+    const IRemoteCommand &remoteCommand, string & /*strResult*/)
+{
+    if (remoteCommand.getArgument(0) == "on") {
+
+        setDirtyTracking(true);
+    } else if (remoteCommand.getArgument(0) == "off") {
+
+        setDirtyTracking(false);
+    } else {
+        // Show usage
+        return CCommandHandler::EShowUsage;
+    }
+    return CCommandHandler::EDone;
+}
+
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getDirtyTrackingCommandProcess(
+    const IRemoteCommand & /*command*/, string &strResult)
+{
+    strResult = dirtyTrackingOn() ? "on" : "off";
+
+    return CCommandHandler::ESucceeded;
+}
+
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getSyncStatisticsCommandProcess(
+    const IRemoteCommand & /*command*/, string &strResult)
+{
+    getConstSystemClass()->listSyncStatistics(strResult);
+
+    return CCommandHandler::ESucceeded;
+}
+
+/// Apply statistics
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::setApplyStatisticsCommandProcess(
+    const IRemoteCommand &remoteCommand, string & /*strResult*/)
+{
+    if (remoteCommand.getArgument(0) == "on") {
+
+        setApplyStatistics(true);
+    } else if (remoteCommand.getArgument(0) == "off") {
+
+        setApplyStatistics(false);
+    } else {
+        // Show usage
+        return CCommandHandler::EShowUsage;
+    }
+    return CCommandHandler::EDone;
+}
+
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getApplyStatisticsCommandProcess(
+    const IRemoteCommand & /*command*/, string &strResult)
+{
+    ApplyStatistics statistics;
+    getApplyStatistics(statistics);
+
+    // Durations in microseconds
+    auto format = [](const LatencySummary &summary) {
+        auto us = [](uint64_t ns) { return std::to_string(ns / 1000) + "us"; };
+        return std::to_string(summary.count) + " samples, mean " + us(summary.mean) + ", p50 " +
+               us(summary.p50) + ", p90 " + us(summary.p90) + ", p99 " + us(summary.p99) +
+               ", max " + us(summary.max) + "\n";
+    };
+    strResult = "Applications: " + format(statistics.apply);
+
+    utility::appendTitle(strResult, "Domains:");
+    for (const auto &domain : statistics.domains) {
+
+        strResult += domain.first + ": " + format(domain.second);
+    }
+    utility::appendTitle(strResult, "Subsystems:");
+    for (const auto &subsystem : statistics.subsystems) {
+
+        strResult += subsystem.first + ": " + format(subsystem.second);
+    }
+    return CCommandHandler::ESucceeded;
+}
+
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::resetApplyStatisticsCommandProcess(
+    const IRemoteCommand & /*command*/, string & /*strResult*/)
+{
+    resetApplyStatistics();
+
+    return CCommandHandler::EDone;
+}
+
+/// Startup profile
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getStartupProfileCommandProcess(
+    const IRemoteCommand & /*command*/, string &strResult)
+{
+    strResult = getStartupProfile();
+
+    return CCommandHandler::ESucceeded;
+}
+
+/// Path index
+string CParameterMgr::formatPathIndexStatistics() const
+{
+    uint64_t hits = _pathIndex.getHits();
+    uint64_t lookups = hits + _pathIndex.getMisses();
+
+    return std::to_string(_pathIndex.getSize()) + " paths, " +
+           std::to_string(_pathIndex.getMemorySize()) + " bytes, " + std::to_string(hits) + "/" +
+           std::to_string(lookups) + " hits (" +
+           std::to_string(lookups != 0 ? hits * 100 / lookups : 0) + "%)";
+}
+
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getPathIndexStatisticsCommandProcess(
+    const IRemoteCommand & /*command*/, string &strResult)
+{
+    strResult = formatPathIndexStatistics();
+
+    return CCommandHandler::ESucceeded;
+}
+
+CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::
+    resetPathIndexStatisticsCommandProcess(const IRemoteCommand & /*command*/,
+                                           string & /*strResult*/)
+{
+    _pathIndex.resetStatistics();
+
+    return CCommandHandler::EDone;
+}
+
 /// Criteria
 CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::listCriteriaCommandProcess(
     const IRemoteCommand &remoteCommand, string &strResult)
@@ -1353,7 +1993,7 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getRuleCommandProce
 CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::listElementsCommandProcess(
     const IRemoteCommand &remoteCommand, string &strResult)
 {
-    CElementLocator elementLocator(getSystemClass(), false);
+    CElementLocator elementLocator(getSystemClass(), false, &_pathIndex);
 
     CElement *pLocatedElement = nullptr;
 
@@ -1380,7 +2020,7 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::listElementsCommand
 CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::listParametersCommandProcess(
     const IRemoteCommand &remoteCommand, string &strResult)
 {
-    CElementLocator elementLocator(getSystemClass(), false);
+    CElementLocator elementLocator(getSystemClass(), false, &_pathIndex);
 
     CElement *pLocatedElement = nullptr;
 
@@ -1406,7 +2046,7 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::listParametersComma
 CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getElementStructureXMLCommandProcess(
     const IRemoteCommand &remoteCommand, string &strResult)
 {
-    CElementLocator elementLocator(getSystemClass());
+    CElementLocator elementLocator(getSystemClass(), true, &_pathIndex);
 
     CElement *pLocatedElement = nullptr;
 
@@ -1430,7 +2070,7 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getElementStructure
 CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getElementBytesCommandProcess(
     const IRemoteCommand &remoteCommand, std::string &strResult)
 {
-    CElementLocator elementLocator(getSystemClass());
+    CElementLocator elementLocator(getSystemClass(), true, &_pathIndex);
 
     CElement *pLocatedElement = nullptr;
 
@@ -1477,7 +2117,7 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::setElementBytesComm
     }
 
     // Retrieve configurable element
-    CElementLocator elementLocator(getSystemClass());
+    CElementLocator elementLocator(getSystemClass(), true, &_pathIndex);
 
     CElement *pLocatedElement = nullptr;
 
@@ -1524,7 +2164,8 @@ bool CParameterMgr::getSettingsAsXML(const CConfigurableElement *configurableEle
                                      string &result) const
 {
     string error;
-    CConfigurationAccessContext configContext(error, _pMainParameterBlackboard, _bValueSpaceIsRaw,
+    CBlackboardReader reader(*this, configurableElement);
+    CConfigurationAccessContext configContext(error, reader.getBlackboard(), _bValueSpaceIsRaw,
                                               _bOutputRawFormatIsHex, true);
 
     CXmlParameterSerializingContext xmlParameterContext(configContext, error);
@@ -1551,6 +2192,9 @@ bool CParameterMgr::setSettingsAsXML(CConfigurableElement *configurableElement,
     CConfigurationAccessContext configContext(error, _pMainParameterBlackboard, _bValueSpaceIsRaw,
                                               _bOutputRawFormatIsHex, false);
 
+    // Ensure we're safe against blackboard foreign access
+    CBlackboardLock autoLock(*this, configurableElement);
+
     CXmlParameterSerializingContext xmlParameterContext(configContext, error);
 
     // It doesn't make sense to resolve XIncludes on an imported file because
@@ -1563,6 +2207,8 @@ bool CParameterMgr::setSettingsAsXML(CConfigurableElement *configurableElement,
                      EParameterConfigurationLibrary, false)) {
         return false;
     }
+    publishBlackboardSnapshot();
+
     if (_bAutoSyncOn) {
         CSyncerSet syncerSet;
         static_cast<CConfigurableElement *>(configurableElement)->fillSyncerSet(syncerSet);
@@ -1579,7 +2225,7 @@ bool CParameterMgr::setSettingsAsXML(CConfigurableElement *configurableElement,
 CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getElementXMLCommandProcess(
     const IRemoteCommand &remoteCommand, string &result)
 {
-    CElementLocator elementLocator(getSystemClass());
+    CElementLocator elementLocator(getSystemClass(), true, &_pathIndex);
 
     CElement *locatedElement = nullptr;
 
@@ -1602,7 +2248,7 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::setElementXMLComman
         return CCommandHandler::EFailed;
     }
 
-    CElementLocator elementLocator(getSystemClass());
+    CElementLocator elementLocator(getSystemClass(), true, &_pathIndex);
 
     CElement *locatedElement = nullptr;
 
@@ -1620,7 +2266,7 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::setElementXMLComman
 CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::dumpElementCommandProcess(
     const IRemoteCommand &remoteCommand, string &strResult)
 {
-    CElementLocator elementLocator(getSystemClass());
+    CElementLocator elementLocator(getSystemClass(), true, &_pathIndex);
 
     CElement *pLocatedElement = nullptr;
 
@@ -1643,7 +2289,7 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::dumpElementCommandP
 CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getElementSizeCommandProcess(
     const IRemoteCommand &remoteCommand, string &strResult)
 {
-    CElementLocator elementLocator(getSystemClass());
+    CElementLocator elementLocator(getSystemClass(), true, &_pathIndex);
 
     CElement *pLocatedElement = nullptr;
 
@@ -1665,7 +2311,7 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::getElementSizeComma
 CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::showPropertiesCommandProcess(
     const IRemoteCommand &remoteCommand, string &strResult)
 {
-    CElementLocator elementLocator(getSystemClass());
+    CElementLocator elementLocator(getSystemClass(), true, &_pathIndex);
 
     CElement *pLocatedElement = nullptr;
 
@@ -1713,7 +2359,7 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::setParameterCommand
 CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::listBelongingDomainsCommandProcess(
     const IRemoteCommand &remoteCommand, string &strResult)
 {
-    CElementLocator elementLocator(getSystemClass());
+    CElementLocator elementLocator(getSystemClass(), true, &_pathIndex);
 
     CElement *pLocatedElement = nullptr;
 
@@ -1735,7 +2381,7 @@ CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::listBelongingDomain
 CParameterMgr::CCommandHandler::CommandStatus CParameterMgr::listAssociatedDomainsCommandProcess(
     const IRemoteCommand &remoteCommand, string &strResult)
 {
-    CElementLocator elementLocator(getSystemClass());
+    CElementLocator elementLocator(getSystemClass(), true, &_pathIndex);
 
     CElement *pLocatedElement = nullptr;
 
@@ -1969,12 +2615,18 @@ bool CParameterMgr::accessParameterValue(const string &strPath, string &strValue
     CParameterAccessContext parameterAccessContext(strError, _pMainParameterBlackboard,
                                                    _bValueSpaceIsRaw, _bOutputRawFormatIsHex);
 
-    // Activate the auto synchronization with the hardware
-    if (bSet) {
+    if (!bSet) {
 
-        parameterAccessContext.setAutoSync(_bAutoSyncOn);
+        // Read the published content, without waiting for a running application
+        CBlackboardReader reader(*this, _bLockSharding ? findSubsystem(strPath) : nullptr);
+        parameterAccessContext.setParameterBlackboard(reader.getBlackboard());
+
+        return doAccessValue(parameterAccessContext, strPath, strValue, false, strError);
     }
 
+    // Activate the auto synchronization with the hardware
+    parameterAccessContext.setAutoSync(_bAutoSyncOn);
+
     return accessValue(parameterAccessContext, strPath, strValue, bSet, strError);
 }
 
@@ -2010,7 +2662,7 @@ bool CParameterMgr::accessConfigurationValue(const string &strDomain,
                                              const string &strConfiguration, const string &strPath,
                                              string &strValue, bool bSet, string &strError)
 {
-    CElementLocator elementLocator(getSystemClass());
+    CElementLocator elementLocator(getSystemClass(), true, &_pathIndex);
 
     CElement *pLocatedElement = nullptr;
 
@@ -2091,7 +2743,59 @@ bool CParameterMgr::accessValue(CParameterAccessContext &parameterAccessContext,
                                 string &strError)
 {
     // Lock state
-    lock_guard<mutex> autoLock(getBlackboardMutex());
+    CBlackboardLock autoLock(*this, _bLockSharding ? findSubsystem(strPath) : nullptr);
+
+    if (!doAccessValue(parameterAccessContext, strPath, strValue, bSet, strError)) {
+
+        return false;
+    }
+    if (bSet && parameterAccessContext.getParameterBlackboard() == _pMainParameterBlackboard) {
+
+        publishBlackboardSnapshot();
+    }
+    return true;
+}
+
+const CSubsystem *CParameterMgr::findSubsystem(const string &strPath) const
+{
+    CPathNavigator pathNavigator(strPath);
+    string strError;
+
+    if (!pathNavigator.navigateThrough(getConstSystemClass()->getName(), strError)) {
+
+        return nullptr;
+    }
+    const string *pStrSubsystemName = pathNavigator.next();
+
+    if (pStrSubsystemName == nullptr) {
+
+        return nullptr;
+    }
+    return static_cast<const CSubsystem *>(getConstSystemClass()->findChild(*pStrSubsystemName));
+}
+
+bool CParameterMgr::doAccessValue(CParameterAccessContext &parameterAccessContext,
+                                  const string &strPath, string &strValue, bool bSet,
+                                  string &strError) const
+{
+    string strIndex;
+    const CConfigurableElement *pIndexedElement = _pathIndex.find(strPath, strIndex);
+
+    if (pIndexedElement) {
+
+        // Only the array index, if any, is left to navigate through
+        std::vector<string> astrItems;
+        string strBasePath = strPath;
+
+        if (!strIndex.empty()) {
+
+            astrItems.push_back(strIndex);
+            strBasePath.resize(strPath.size() - strIndex.size() - 1);
+        }
+        CPathNavigator pathNavigator(strBasePath, std::move(astrItems));
+
+        return pIndexedElement->accessValue(pathNavigator, strValue, bSet, parameterAccessContext);
+    }
 
     CPathNavigator pathNavigator(strPath);
 
@@ -2123,7 +2827,7 @@ bool CParameterMgr::setTuningMode(bool bOn, string &strError)
         return false;
     }
     // Lock state
-    lock_guard<mutex> autoLock(getBlackboardMutex());
+    CBlackboardLock autoLock(*this);
 
     // Warn domains about exiting tuning mode
     if (!bOn) {
@@ -2192,6 +2896,116 @@ bool CParameterMgr::autoSyncOn() const
     return _bAutoSyncOn;
 }
 
+// Applicable configuration memoization
+void CParameterMgr::setDecisionCache(bool bOn)
+{
+    // Domain decision caches are used by applications
+    CBlackboardLock autoLock(*this);
+
+    getConfigurableDomains()->setDecisionCacheEnabled(bOn);
+}
+
+bool CParameterMgr::decisionCacheOn() const
+{
+    CBlackboardLock autoLock(*this);
+
+    return getConstConfigurableDomains()->isDecisionCacheEnabled();
+}
+
+// Skipping of the synchronization of unmodified subsystem objects
+void CParameterMgr::setDirtyTracking(bool bOn)
+{
+    // Line generations are reallocated, while applications and writes may touch them
+    CBlackboardLock autoLock(*this);
+
+    if (bOn != _pMainParameterBlackboard->isDirtyTrackingEnabled()) {
+
+        _pMainParameterBlackboard->setDirtyTrackingEnabled(bOn);
+    }
+}
+
+bool CParameterMgr::dirtyTrackingOn() const
+{
+    CBlackboardLock autoLock(*this);
+
+    return _pMainParameterBlackboard->isDirtyTrackingEnabled();
+}
+
+// Application latencies
+void CParameterMgr::setApplyStatistics(bool bOn)
+{
+    _bApplyStatisticsOn = bOn;
+
+    getConfigurableDomains()->setApplyLatencyRecorded(bOn);
+
+    CSystemClass *pSystemClass = getSystemClass();
+
+    for (size_t child = 0; child < pSystemClass->getNbChildren(); child++) {
+
+        static_cast<CSubsystem *>(pSystemClass->getChild(child))->setSyncLatencyRecorded(bOn);
+    }
+}
+
+std::string CParameterMgr::getStartupProfile() const
+{
+    return _startupProfile.toJson();
+}
+
+bool CParameterMgr::applyStatisticsOn() const
+{
+    return _bApplyStatisticsOn;
+}
+
+void CParameterMgr::getApplyStatistics(ApplyStatistics &statistics) const
+{
+    auto summarize = [](const utility::LatencyHistogram &histogram) {
+        LatencySummary summary;
+        summary.count = histogram.getCount();
+        summary.mean = summary.count != 0 ? histogram.getTotal() / summary.count : 0;
+        summary.p50 = histogram.getPercentile(50);
+        summary.p90 = histogram.getPercentile(90);
+        summary.p99 = histogram.getPercentile(99);
+        summary.max = histogram.getMax();
+        return summary;
+    };
+    statistics.apply = summarize(*_applyLatency);
+
+    const CConfigurableDomains *pDomains = getConstConfigurableDomains();
+
+    for (size_t child = 0; child < pDomains->getNbChildren(); child++) {
+
+        auto *pDomain = static_cast<const CConfigurableDomain *>(pDomains->getChild(child));
+        statistics.domains[pDomain->getName()] = summarize(pDomain->getApplyLatency());
+    }
+    const CSystemClass *pSystemClass = getConstSystemClass();
+
+    for (size_t child = 0; child < pSystemClass->getNbChildren(); child++) {
+
+        auto *pSubsystem = static_cast<const CSubsystem *>(pSystemClass->getChild(child));
+        statistics.subsystems[pSubsystem->getName()] = summarize(pSubsystem->getSyncLatency());
+    }
+}
+
+void CParameterMgr::resetApplyStatistics()
+{
+    _applyLatency->reset();
+
+    CConfigurableDomains *pDomains = getConfigurableDomains();
+
+    for (size_t child = 0; child < pDomains->getNbChildren(); child++) {
+
+        static_cast<const CConfigurableDomain *>(pDomains->getChild(child))
+            ->getApplyLatency()
+            .reset();
+    }
+    CSystemClass *pSystemClass = getSystemClass();
+
+    for (size_t child = 0; child < pSystemClass->getNbChildren(); child++) {
+
+        static_cast<CSubsystem *>(pSystemClass->getChild(child))->resetSyncLatency();
+    }
+}
+
 // Manual hardware synchronization control (during tuning session)
 bool CParameterMgr::sync(string &strError)
 {
@@ -2210,7 +3024,7 @@ bool CParameterMgr::sync(string &strError)
 
     // Sync
     core::Results error;
-    if (!syncerSet.sync(*_pMainParameterBlackboard, false, &error)) {
+    if (!syncerSet.sync(*_pMainParameterBlackboard, false, &error, _syncThreadPool.get())) {
 
         strError = utility::asString(error);
         return false;
@@ -2398,7 +3212,7 @@ bool CParameterMgr::addConfigurableElementToDomain(const string &strDomain,
         return false;
     }
 
-    CElementLocator elementLocator(getSystemClass());
+    CElementLocator elementLocator(getSystemClass(), true, &_pathIndex);
 
     CElement *pLocatedElement = nullptr;
 
@@ -2441,7 +3255,7 @@ bool CParameterMgr::removeConfigurableElementFromDomain(const string &strDomain,
         return false;
     }
 
-    CElementLocator elementLocator(getSystemClass());
+    CElementLocator elementLocator(getSystemClass(), true, &_pathIndex);
 
     CElement *pLocatedElement = nullptr;
 
@@ -2473,7 +3287,7 @@ bool CParameterMgr::split(const string &strDomain, const string &strConfigurable
         return false;
     }
 
-    CElementLocator elementLocator(getSystemClass());
+    CElementLocator elementLocator(getSystemClass(), true, &_pathIndex);
 
     CElement *pLocatedElement = nullptr;
 
@@ -2644,6 +3458,26 @@ bool CParameterMgr::exportDomainsXml(string &xmlDest, bool withSettings, bool to
     return wrapLegacyXmlExport(xmlDest, toFile, withSettings, *configurableDomains, errorMsg);
 }
 
+bool CParameterMgr::exportDomainsBundle(const string &bundlePath, string &errorMsg)
+{
+    LOG_CONTEXT("Exporting domains bundle to \"" + bundlePath + '"');
+
+    CDomainsBundleWriter writer(*getSystemClass());
+
+    getConstConfigurableDomains()->toBundle(writer);
+
+    const std::vector<uint8_t> &data = writer.getData();
+    std::ofstream output(bundlePath, std::ios::binary);
+
+    if (!output.write(reinterpret_cast<const char *>(data.data()),
+                      static_cast<std::streamsize>(data.size()))) {
+
+        errorMsg = "Could not write domains bundle " + bundlePath;
+        return false;
+    }
+    return true;
+}
+
 bool CParameterMgr::exportSingleDomainXml(string &xmlDest, const string &domainName,
                                           bool withSettings, bool toFile, string &errorMsg) const
 {
@@ -2722,18 +3556,121 @@ bool CParameterMgr::checkTuningModeOn(string &strError) const
     return true;
 }
 
-// Tuning mutex dynamic parameter handling
-std::mutex &CParameterMgr::getBlackboardMutex()
-{
-    return _blackboardMutex;
-}
-
 // Blackboard reference (dynamic parameter handling)
 CParameterBlackboard *CParameterMgr::getParameterBlackboard()
 {
     return _pMainParameterBlackboard;
 }
 
+CParameterMgr::CBlackboardLock::CBlackboardLock(const CParameterMgr &parameterMgr,
+                                                const CConfigurableElement *pElement, bool bLock)
+{
+    if (!bLock) {
+
+        return;
+    }
+    const CSubsystem *pSubsystem =
+        (parameterMgr._bLockSharding && pElement != nullptr) ? pElement->getBelongingSubsystem()
+                                                              : nullptr;
+
+    if (pSubsystem != nullptr) {
+
+        // Only the accessed subsystem
+        mLock = std::unique_lock<mutex>(pSubsystem->getAccessMutex());
+        return;
+    }
+    mLock = std::unique_lock<mutex>(parameterMgr._blackboardMutex);
+
+    if (parameterMgr._bLockSharding) {
+
+        // Then all subsystems, in their structure order
+        const CSystemClass *pSystemClass = parameterMgr.getConstSystemClass();
+        mSubsystemLocks.reserve(pSystemClass->getNbChildren());
+
+        for (size_t child = 0; child < pSystemClass->getNbChildren(); child++) {
+
+            auto *pChildSubsystem = static_cast<const CSubsystem *>(pSystemClass->getChild(child));
+            mSubsystemLocks.emplace_back(pChildSubsystem->getAccessMutex());
+        }
+    }
+}
+
+CParameterMgr::CBlackboardReader::CBlackboardReader(const CParameterMgr &parameterMgr,
+                                                    const CConfigurableElement *pElement)
+    : mSnapshot(parameterMgr.getBlackboardSnapshot()),
+      mBlackboard(mSnapshot != nullptr ? mSnapshot.get() : parameterMgr._pMainParameterBlackboard),
+      mLock(parameterMgr, pElement, mSnapshot == nullptr)
+{
+    if (mSnapshot == nullptr && !parameterMgr._bLockSharding && !parameterMgr.tuningModeOn()) {
+
+        // Let the following readers see the current content without locking
+        parameterMgr.publishBlackboardSnapshot();
+    }
+}
+
+CParameterBlackboard *CParameterMgr::CBlackboardReader::getBlackboard() const
+{
+    return mBlackboard;
+}
+
+std::shared_ptr<CParameterBlackboard> CParameterMgr::getBlackboardSnapshot() const
+{
+    if (_bLockSharding || tuningModeOn()) {
+
+        return nullptr;
+    }
+    _bSnapshotRead.store(true, std::memory_order_relaxed);
+
+    return std::atomic_load(&_publishedBlackboard);
+}
+
+void CParameterMgr::publishBlackboardSnapshot() const
+{
+    if (_bLockSharding) {
+
+        // Readers lock their subsystem instead
+        return;
+    }
+    uint64_t generation = _pMainParameterBlackboard->getGeneration();
+
+    if (_publishedBlackboard != nullptr && generation == _publishedGeneration) {
+
+        // Readers already see the current content
+        return;
+    }
+    if (!_bSnapshotRead.exchange(false, std::memory_order_relaxed)) {
+
+        // Nobody read since the previous publication: do not copy for nobody, the next reader
+        // locks and publishes
+        auto withdrawn = std::atomic_exchange(&_publishedBlackboard,
+                                              std::shared_ptr<CParameterBlackboard>());
+        if (withdrawn != nullptr) {
+
+            _spareBlackboard = std::move(withdrawn);
+        }
+        return;
+    }
+    // Recycle the spare copy, unless a reader still holds it
+    std::shared_ptr<CParameterBlackboard> snapshot = std::move(_spareBlackboard);
+
+    if (snapshot == nullptr || snapshot.use_count() != 1) {
+
+        snapshot = std::make_shared<CParameterBlackboard>();
+    } else {
+
+        // Order the last reads of the releasing reader before the following writes
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    if (snapshot->getSize() != _pMainParameterBlackboard->getSize()) {
+
+        snapshot->setSize(_pMainParameterBlackboard->getSize());
+    }
+    snapshot->restoreFrom(_pMainParameterBlackboard, 0);
+
+    _spareBlackboard = std::atomic_exchange(&_publishedBlackboard, std::move(snapshot));
+    _publishedGeneration = generation;
+}
+
 // Dynamic creation library feeding
 void CParameterMgr::feedElementLibraries()
 {
@@ -2750,11 +3687,17 @@ void CParameterMgr::feedElementLibraries()
     pFrameworkConfigurationLibrary->addElementBuilder(
         "StructureDescriptionFileLocation",
         new TKindElementBuilderTemplate<CFrameworkConfigurationLocation>());
+    pFrameworkConfigurationLibrary->addElementBuilder(
+        "StructureCacheFileLocation",
+        new TKindElementBuilderTemplate<CFrameworkConfigurationLocation>());
     pFrameworkConfigurationLibrary->addElementBuilder(
         "SettingsConfiguration", new TKindElementBuilderTemplate<CFrameworkConfigurationGroup>());
     pFrameworkConfigurationLibrary->addElementBuilder(
         "ConfigurableDomainsFileLocation",
         new TKindElementBuilderTemplate<CFrameworkConfigurationLocation>());
+    pFrameworkConfigurationLibrary->addElementBuilder(
+        "ConfigurableDomainsBundleFileLocation",
+        new TKindElementBuilderTemplate<CFrameworkConfigurationLocation>());
 
     _pElementLibrarySet->addElementLibrary(pFrameworkConfigurationLibrary);
 
@@ -2925,20 +3868,29 @@ const CConfigurableDomains *CParameterMgr::getConstConfigurableDomains() const
 }
 
 // Apply configurations
-void CParameterMgr::doApplyConfigurations(bool bForce)
+void CParameterMgr::doApplyConfigurations(bool bForce, ApplyReport *pReport)
 {
     LOG_CONTEXT("Applying configurations");
 
+    utility::ScopedLatency latency(_bApplyStatisticsOn ? _applyLatency.get() : nullptr);
+
     CSyncerSet syncerSet;
 
     core::Results infos;
     // Check subsystems that need resync
-    getSystemClass()->checkForSubsystemsToResync(syncerSet, infos);
+    getSystemClass()->checkForSubsystemsToResync(_pMainParameterBlackboard, syncerSet, infos);
 
     // Ensure application of currently selected configurations
-    getConfigurableDomains()->apply(_pMainParameterBlackboard, syncerSet, bForce, infos);
+    bool bApplied = getConfigurableDomains()->apply(_pMainParameterBlackboard, syncerSet, bForce,
+                                                    infos, pReport);
     info() << infos;
 
+    // Let readers see the applied configurations
+    if (bApplied) {
+
+        publishBlackboardSnapshot();
+    }
+
     // Reset the modified status of the current criteria to indicate that a new configuration has
     // been applied
     getSelectionCriteria()->resetModifiedStatus();
@@ -29,8 +29,12 @@
  */
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <mutex>
 #include <map>
+#include <thread>
 #include <vector>
 #include "RemoteCommandHandlerTemplate.h"
 #include "PathNavigator.h"
@@ -42,6 +46,12 @@
 #include "XmlDomainExportContext.h"
 #include "Results.h"
 #include "ElementHandle.h"
+#include "ApplyReport.h"
+#include "CriteriaTransaction.h"
+#include "ParameterTransaction.h"
+#include "ApplyStatistics.h"
+#include "PathIndex.h"
+#include "StartupProfile.h"
 #include <log/LogWrapper.h>
 #include <log/Context.h>
 
@@ -62,6 +72,14 @@ class CParameterHandle;
 class CSubsystemPlugins;
 class CParameterAccessContext;
 class CConfigurableElement;
+class CSubsystem;
+class CXmlDocLoader;
+
+namespace utility
+{
+class ThreadPool;
+class LatencyHistogram;
+} // namespace utility
 
 class CParameterMgr : private CElement
 {
@@ -81,6 +99,11 @@ class CParameterMgr : private CElement
 
     // Parameter handle friendship
     friend class ElementHandle;
+    friend class ParameterTransaction;
+    template <class T>
+    friend class BoundParameter;
+    friend class ParameterArrayView;
+    friend class WritableParameterArrayView;
 
 public:
     // Construction
@@ -115,6 +138,25 @@ public:
     // Configuration application
     void applyConfigurations();
 
+    /** Request a configuration application from the apply thread
+     *
+     * Requests made while an application is in progress are coalesced into a single application
+     * following it.
+     *
+     * @param[in] callback called from the apply thread once an application started after the
+     *                     request is done, may be empty
+     */
+    void applyConfigurationsAsync(ApplyCallback callback);
+
+    /** Publish staged criterion states and apply configurations, all at once
+     *
+     * No application can happen while the states are published. Configurations are applied
+     * once, unless the tuning mode is on.
+     *
+     * @param[in] transaction the staged criterion states
+     */
+    void applyCriteriaTransaction(const CriteriaTransaction &transaction);
+
     /** const version of getConfigurableElement */
     const CConfigurableElement *getConfigurableElement(const std::string &strPath,
                                                        std::string &strError) const;
@@ -144,6 +186,12 @@ public:
      */
     ElementHandle *createElementHandle(const std::string &path, std::string &error);
 
+    /** Creates a transaction to write several parameters at once.
+     *
+     * The returned object is owned by the client who is responsible to delete it.
+     */
+    ParameterTransaction *createParameterTransaction();
+
     /** Is the remote interface forcefully disabled ?
      */
     bool getForceNoRemoteInterface() const;
@@ -180,6 +228,51 @@ public:
       */
     bool getFailureOnFailedSettingsLoad() const;
 
+    /** Number of threads applying domains concurrently.
+      *
+      * @param[in] threadCount: 0 to rely on the ApplyThreadCount attribute of the framework
+      *                         configuration, 1 to apply domains serially.
+      */
+    void setApplyThreadCount(size_t threadCount);
+    /** Number of threads applying domains concurrently.
+      *
+      * @return the requested count, 0 if relying on the framework configuration.
+      */
+    size_t getApplyThreadCount() const;
+
+    /** Number of threads synchronizing subsystems concurrently.
+      *
+      * @param[in] threadCount: 0 to rely on the SyncThreadCount attribute of the framework
+      *                         configuration, 1 to synchronize subsystems serially.
+      */
+    void setSyncThreadCount(size_t threadCount);
+    /** Number of threads synchronizing subsystems concurrently.
+      *
+      * @return the requested count, 0 if relying on the framework configuration.
+      */
+    size_t getSyncThreadCount() const;
+
+    /** Number of threads parsing structure and settings files concurrently.
+      *
+      * @param[in] threadCount: 0 to rely on the LoadThreadCount attribute of the framework
+      *                         configuration, 1 to parse files serially.
+      */
+    void setLoadThreadCount(size_t threadCount);
+    /** Number of threads parsing structure and settings files concurrently.
+      *
+      * @return the requested count, 0 if relying on the framework configuration.
+      */
+    size_t getLoadThreadCount() const;
+
+    /** Lock parameter accesses per subsystem, see CBlackboardLock.
+      *
+      * Not to be changed once started.
+      *
+      * @param[in] bEnabled true to lock per subsystem, false to lock all parameters at once.
+      */
+    void setLockSharding(bool bEnabled);
+    bool isLockShardingEnabled() const;
+
     /** Get the XML Schemas URI
      *
      * @returns the XML Schemas URI
@@ -236,6 +329,32 @@ public:
     bool autoSyncOn() const;
     bool sync(std::string &strError);
 
+    // Applicable configuration memoization, per domain
+    void setDecisionCache(bool bOn);
+    bool decisionCacheOn() const;
+
+    // Skipping of the synchronization of unmodified subsystem objects
+    void setDirtyTracking(bool bOn);
+    bool dirtyTrackingOn() const;
+
+    /** Record or not the latencies of applications, of domain applications and of subsystem
+     * object synchronizations
+     *
+     * @param[in] bOn true to record
+     */
+    void setApplyStatistics(bool bOn);
+    bool applyStatisticsOn() const;
+
+    /** @param[out] statistics the latencies recorded so far */
+    void getApplyStatistics(ApplyStatistics &statistics) const;
+
+    /** Forget the latencies recorded so far */
+    void resetApplyStatistics();
+
+    /** @return the durations and heap growth of the last start phases, in JSON, see
+     * CStartupProfile::toJson */
+    std::string getStartupProfile() const;
+
     // User set/get parameters
     bool accessParameterValue(const std::string &strPath, std::string &strValue, bool bSet,
                               std::string &strError);
@@ -350,6 +469,19 @@ public:
     bool exportDomainsXml(std::string &xmlDest, bool withSettings, bool toFile,
                           std::string &errorMsg) const;
 
+    /** Compile the Configurable Domains, with their settings, to a binary bundle
+     *
+     * The bundle can be loaded at start instead of the XML settings file, see the
+     * ConfigurableDomainsBundleFileLocation framework configuration element. It is only valid
+     * for the structure it has been compiled for.
+     *
+     * @param[in] bundlePath the path of the bundle file to write
+     * @param[out] errorMsg is used as the error output
+     *
+     * @return false if any error occurs, true otherwise.
+     */
+    bool exportDomainsBundle(const std::string &bundlePath, std::string &errorMsg);
+
     /**
       * Method that exports a given Configurable Domain to an Xml destination.
       *
@@ -447,6 +579,37 @@ private:
                                                              std::string &strResult);
     CCommandHandler::CommandStatus syncCommandProcess(const IRemoteCommand &remoteCommand,
                                                       std::string &strResult);
+    /// Decision cache
+    CCommandHandler::CommandStatus setDecisionCacheCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
+    CCommandHandler::CommandStatus getDecisionCacheCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
+    CCommandHandler::CommandStatus getDecisionCacheStatisticsCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
+    /// Dirty tracking
+    CCommandHandler::CommandStatus setDirtyTrackingCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
+    CCommandHandler::CommandStatus getDirtyTrackingCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
+    CCommandHandler::CommandStatus getSyncStatisticsCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
+    /// Apply statistics
+    CCommandHandler::CommandStatus setApplyStatisticsCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
+    CCommandHandler::CommandStatus getApplyStatisticsCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
+    CCommandHandler::CommandStatus resetApplyStatisticsCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
+    /// Startup profile
+    CCommandHandler::CommandStatus getStartupProfileCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
+    /// Path index
+    /** @return the size, memory usage and hit rate of the path index */
+    std::string formatPathIndexStatistics() const;
+    CCommandHandler::CommandStatus getPathIndexStatisticsCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
+    CCommandHandler::CommandStatus resetPathIndexStatisticsCommandProcess(
+        const IRemoteCommand &remoteCommand, std::string &strResult);
     /// Criteria
     CCommandHandler::CommandStatus listCriteriaCommandProcess(const IRemoteCommand &remoteCommand,
                                                               std::string &strResult);
@@ -629,15 +792,88 @@ private:
     // For tuning, check we're in tuning mode
     bool checkTuningModeOn(std::string &strError) const;
 
-    // Blackboard (dynamic parameter handling)
-    std::mutex &getBlackboardMutex();
-
     // Blackboard reference (dynamic parameter handling)
     CParameterBlackboard *getParameterBlackboard();
 
+    /** Lock of the main blackboard
+     *
+     * Without lock sharding, holds the blackboard mutex.
+     * With lock sharding, holds the access mutex of the subsystem of the given element only.
+     * Without element, as for applications and tuning, holds the blackboard mutex then the
+     * access mutexes of all subsystems, always in the same order to avoid deadlocks.
+     */
+    class CBlackboardLock
+    {
+    public:
+        /**
+         * @param[in] parameterMgr the parameter manager owning the blackboard
+         * @param[in] pElement the element to access, nullptr to lock the whole blackboard
+         * @param[in] bLock false to create an unlocked instance
+         */
+        CBlackboardLock(const CParameterMgr &parameterMgr,
+                        const CConfigurableElement *pElement = nullptr, bool bLock = true);
+
+    private:
+        std::unique_lock<std::mutex> mLock;
+        std::vector<std::unique_lock<std::mutex>> mSubsystemLocks;
+    };
+
+    /** Read access to the main blackboard content
+     *
+     * Outside of tuning mode, reads the last snapshot published by publishBlackboardSnapshot
+     * without locking, so that readers are never blocked by an application.
+     * In tuning mode or with lock sharding, reads the main blackboard under a CBlackboardLock.
+     * When no snapshot is published, reads the main blackboard under a CBlackboardLock and
+     * publishes it for the following readers.
+     */
+    class CBlackboardReader
+    {
+    public:
+        /**
+         * @param[in] parameterMgr the parameter manager owning the blackboard
+         * @param[in] pElement the element to read, nullptr if unknown
+         */
+        CBlackboardReader(const CParameterMgr &parameterMgr,
+                          const CConfigurableElement *pElement = nullptr);
+
+        /** @return the blackboard to read from, valid during the reader lifetime */
+        CParameterBlackboard *getBlackboard() const;
+
+    private:
+        std::shared_ptr<CParameterBlackboard> mSnapshot;
+        CParameterBlackboard *mBlackboard;
+        CBlackboardLock mLock;
+    };
+
+    /** Get the snapshot to read from, recording that snapshots have a reader
+     *
+     * @return the last published blackboard snapshot, nullptr if readers are to lock instead
+     */
+    std::shared_ptr<CParameterBlackboard> getBlackboardSnapshot() const;
+
+    /** Publish the main blackboard content to the readers
+     *
+     * To be called with the whole blackboard locked, after the main blackboard was written.
+     * Does nothing if the main blackboard did not change since the previous publication, or
+     * with lock sharding, where readers do not use snapshots.
+     * If no reader got the previous snapshot, withdraws it instead of copying the blackboard:
+     * the next reader locks and publishes again.
+     */
+    void publishBlackboardSnapshot() const;
+
+    /** Subsystem designated by a parameter path
+     *
+     * @param[in] strPath the parameter path
+     * @return the subsystem, nullptr if the path does not designate one
+     */
+    const CSubsystem *findSubsystem(const std::string &strPath) const;
+
     // Parameter access
     bool accessValue(CParameterAccessContext &parameterAccessContext, const std::string &strPath,
                      std::string &strValue, bool bSet, std::string &strError);
+    /** Access a value without locking the blackboard, see accessValue */
+    bool doAccessValue(CParameterAccessContext &parameterAccessContext, const std::string &strPath,
+                       std::string &strValue, bool bSet, std::string &strError) const;
     bool doSetValue(const std::string &strPath, const std::string &strValue, bool bRawValueSpace,
                     bool bDynamicAccess, std::string &strError) const;
     bool doGetValue(const std::string &strPath, std::string &strValue, bool bRawValueSpace,
@@ -660,6 +896,17 @@ private:
     bool loadSettings(std::string &strError);
     bool loadSettingsFromConfigFile(std::string &strError);
 
+    /** Replace the configurable domains by those of a compiled bundle
+     *
+     * @param[in] bundleUri the URI of the bundle file
+     * @param[out] strError the reason of the failure
+     * @return true if succeed false otherwise, in which case no domain is left
+     */
+    bool importDomainsBundle(const std::string &bundleUri, std::string &strError);
+
+    /** Log the time spent parsing each file of a loader, and add it to the startup profile */
+    void logParseTimes(const CXmlDocLoader &docLoader);
+
     /** Get settings from a configurable element in binary format.
      *
      * @param[in] element configurable element.
@@ -713,12 +960,15 @@ private:
      * @param[in] eElementLibrary which element library to be used
      * @param[in] replace Should the element be overridden or modified in place
      * @param[in] strNameAttributeName the name of the element's XML "name" attribute
+     * @param[in] bValidate whether to validate the document against its schema, if validation
+     *                      is enabled
      *
      * @returns true if parsing succeeded, false otherwise
      */
     bool xmlParse(CXmlElementSerializingContext &elementSerializingContext, CElement *pRootElement,
                   _xmlDoc *doc, const std::string &baseUri, ElementLibrary eElementLibrary,
-                  bool replace = true, const std::string &strNameAttributeName = "Name");
+                  bool replace = true, const std::string &strNameAttributeName = "Name",
+                  bool bValidate = true);
 
     /** Wrapper for converting public APIs semantics to internal API
      *
@@ -819,8 +1069,18 @@ private:
     const CConfigurableDomains *getConstConfigurableDomains();
     const CConfigurableDomains *getConstConfigurableDomains() const;
 
-    // Apply configurations
-    void doApplyConfigurations(bool bForce);
+    /** Apply configurations
+     *
+     * @param[in] bForce true to apply configurations even if already applied
+     * @param[out] pReport filled with the applied configurations and sync errors, if not null
+     */
+    void doApplyConfigurations(bool bForce, ApplyReport *pReport = nullptr);
+
+    /** Serve asynchronous application requests until stopped */
+    void applyThreadMain();
+
+    /** Stop the apply thread, once pending requests are served */
+    void stopApplyThread();
 
     // Dynamic object creation libraries feeding
     void feedElementLibraries();
@@ -844,7 +1104,7 @@ private:
     inline core::log::details::Warning warning();
 
     // Tuning
-    bool _bTuningModeIsOn{false};
+    std::atomic<bool> _bTuningModeIsOn{false};
 
     // Value Space
     bool _bValueSpaceIsRaw{false};
@@ -878,7 +1138,19 @@ private:
     size_t _maxCommandUsageLength{0};
 
     // Blackboard access mutex
-    std::mutex _blackboardMutex;
+    mutable std::mutex _blackboardMutex;
+
+    /** Last published copy of the main blackboard, accessed atomically */
+    mutable std::shared_ptr<CParameterBlackboard> _publishedBlackboard;
+    /** Main blackboard generation when it was published */
+    mutable uint64_t _publishedGeneration{0};
+    /** Copy published before the last one, recycled once no reader holds it anymore */
+    mutable std::shared_ptr<CParameterBlackboard> _spareBlackboard;
+    /** Has a reader asked for a snapshot since the last publication */
+    mutable std::atomic<bool> _bSnapshotRead{false};
+
+    /** Are parameter accesses locked per subsystem */
+    bool _bLockSharding{false};
 
     /** Application main logger based on the one provided by the client */
     mutable core::log::Logger _logger;
@@ -905,4 +1177,44 @@ private:
      * If set to false, no .xml/xsd validation will happen (default behaviour)
      */
     bool _bValidateSchemasOnStart{false};
+
+    /** Number of threads applying domains, 0 to rely on the framework configuration */
+    size_t _applyThreadCount{0};
+
+    /** Pool applying domains concurrently, none if applied serially */
+    std::unique_ptr<utility::ThreadPool> _applyThreadPool;
+
+    /** Number of threads synchronizing subsystems, 0 to rely on the framework configuration */
+    size_t _syncThreadCount{0};
+
+    /** Pool synchronizing subsystems concurrently, none if synchronized serially */
+    std::unique_ptr<utility::ThreadPool> _syncThreadPool;
+
+    /** Number of threads parsing files, 0 to rely on the framework configuration */
+    size_t _loadThreadCount{0};
+
+    /** Pool parsing files concurrently while loading, none if parsed serially */
+    std::unique_ptr<utility::ThreadPool> _loadThreadPool;
+
+    /** Are application latencies recorded */
+    bool _bApplyStatisticsOn{false};
+
+    /** Latencies of whole applications */
+    std::unique_ptr<utility::LatencyHistogram> _applyLatency;
+
+    /** Phases of the last start */
+    CStartupProfile _startupProfile;
+
+    /** Configurable elements by path, filled once the structure is loaded */
+    CPathIndex _pathIndex;
+
+    /** Thread serving asynchronous application requests, started by the first one */
+    std::thread _applyThread;
+    /** Protects the asynchronous application requests */
+    std::mutex _applyRequestMutex;
+    std::condition_variable _applyRequestCondition;
+    /** Callbacks of the requests to serve with the next application, which is due if any */
+    std::vector<ApplyCallback> _pendingApplyCallbacks;
+    bool _bApplyRequested{false};
+    bool _bStopApplyThread{false};
 };
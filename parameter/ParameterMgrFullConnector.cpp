@@ -261,6 +261,11 @@ bool CParameterMgrFullConnector::exportDomainsXml(string &strXmlDest, bool bWith
     return _pParameterMgr->exportDomainsXml(strXmlDest, bWithSettings, bToFile, strError);
 }
 
+bool CParameterMgrFullConnector::exportDomainsBundle(const string &bundlePath, string &strError)
+{
+    return _pParameterMgr->exportDomainsBundle(bundlePath, strError);
+}
+
 // deprecated, use the other version of importSingleDomainXml instead
 bool CParameterMgrFullConnector::importSingleDomainXml(const string &strXmlSource, bool bOverwrite,
                                                        string &strError)
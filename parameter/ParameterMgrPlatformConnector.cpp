@@ -82,6 +82,55 @@ void CParameterMgrPlatformConnector::applyConfigurations()
     _pParameterMgr->applyConfigurations();
 }
 
+bool CParameterMgrPlatformConnector::applyCriteriaTransaction(
+    const CriteriaTransaction &transaction)
+{
+    if (!_bStarted) {
+
+        return false;
+    }
+    _pParameterMgr->applyCriteriaTransaction(transaction);
+    return true;
+}
+
+void CParameterMgrPlatformConnector::setApplyStatisticsEnabled(bool bEnabled)
+{
+    _pParameterMgr->setApplyStatistics(bEnabled);
+}
+
+bool CParameterMgrPlatformConnector::isApplyStatisticsEnabled() const
+{
+    return _pParameterMgr->applyStatisticsOn();
+}
+
+ApplyStatistics CParameterMgrPlatformConnector::getApplyStatistics() const
+{
+    ApplyStatistics statistics;
+    _pParameterMgr->getApplyStatistics(statistics);
+
+    return statistics;
+}
+
+std::string CParameterMgrPlatformConnector::getStartupProfile() const
+{
+    return _pParameterMgr->getStartupProfile();
+}
+
+void CParameterMgrPlatformConnector::resetApplyStatistics()
+{
+    _pParameterMgr->resetApplyStatistics();
+}
+
+bool CParameterMgrPlatformConnector::applyConfigurationsAsync(ApplyCallback callback)
+{
+    if (!_bStarted) {
+
+        return false;
+    }
+    _pParameterMgr->applyConfigurationsAsync(std::move(callback));
+    return true;
+}
+
 // Dynamic parameter handling
 CParameterHandle *CParameterMgrPlatformConnector::createParameterHandle(const string &strPath,
                                                                         string &strError) const
@@ -97,6 +146,11 @@ ElementHandle *CParameterMgrPlatformConnector::createElementHandle(const string
     return _pParameterMgr->createElementHandle(strPath, strError);
 }
 
+ParameterTransaction *CParameterMgrPlatformConnector::createParameterTransaction() const
+{
+    return _pParameterMgr->createParameterTransaction();
+}
+
 // Logging
 void CParameterMgrPlatformConnector::setLogger(CParameterMgrPlatformConnector::ILogger *pLogger)
 {
@@ -148,6 +202,74 @@ bool CParameterMgrPlatformConnector::getFailureOnFailedSettingsLoad() const
     return _pParameterMgr->getFailureOnFailedSettingsLoad();
 }
 
+bool CParameterMgrPlatformConnector::setApplyThreadCount(size_t threadCount, string &strError)
+{
+    if (_bStarted) {
+
+        strError = "Can not set apply thread count while running";
+        return false;
+    }
+
+    _pParameterMgr->setApplyThreadCount(threadCount);
+    return true;
+}
+
+size_t CParameterMgrPlatformConnector::getApplyThreadCount() const
+{
+    return _pParameterMgr->getApplyThreadCount();
+}
+
+bool CParameterMgrPlatformConnector::setSyncThreadCount(size_t threadCount, string &strError)
+{
+    if (_bStarted) {
+
+        strError = "Can not set sync thread count while running";
+        return false;
+    }
+
+    _pParameterMgr->setSyncThreadCount(threadCount);
+    return true;
+}
+
+size_t CParameterMgrPlatformConnector::getSyncThreadCount() const
+{
+    return _pParameterMgr->getSyncThreadCount();
+}
+
+bool CParameterMgrPlatformConnector::setLoadThreadCount(size_t threadCount, string &strError)
+{
+    if (_bStarted) {
+
+        strError = "Can not set load thread count while running";
+        return false;
+    }
+
+    _pParameterMgr->setLoadThreadCount(threadCount);
+    return true;
+}
+
+size_t CParameterMgrPlatformConnector::getLoadThreadCount() const
+{
+    return _pParameterMgr->getLoadThreadCount();
+}
+
+bool CParameterMgrPlatformConnector::setLockSharding(bool bEnabled, string &strError)
+{
+    if (_bStarted) {
+
+        strError = "Can not set lock sharding while running";
+        return false;
+    }
+
+    _pParameterMgr->setLockSharding(bEnabled);
+    return true;
+}
+
+bool CParameterMgrPlatformConnector::isLockShardingEnabled() const
+{
+    return _pParameterMgr->isLockShardingEnabled();
+}
+
 const string &CParameterMgrPlatformConnector::getSchemaUri() const
 {
     return _pParameterMgr->getSchemaUri();
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "ParameterTransaction.h"
+#include "ElementHandle.h"
+#include "ParameterAccessContext.h"
+#include "ParameterBlackboard.h"
+#include "BaseParameter.h"
+#include "BitParameter.h"
+#include "SyncerSet.h"
+#include "ParameterMgr.h"
+#include "ThreadPool.hpp"
+#include "Utility.h"
+
+using std::string;
+
+/** @return 0 by default, ie for non overloaded types. */
+template <class T>
+static size_t getUserInputSize(const T & /*scalar*/)
+{
+    return 0;
+}
+
+/** @return the vector's size. */
+template <class T>
+static size_t getUserInputSize(const std::vector<T> &vector)
+{
+    return vector.size();
+}
+
+ParameterTransaction::ParameterTransaction(CParameterMgr &parameterMgr)
+    : mParameterMgr(parameterMgr)
+{
+}
+
+ParameterTransaction::~ParameterTransaction() = default;
+
+template <class T>
+bool ParameterTransaction::queue(const ElementHandle &handle, const T &value, string &error)
+{
+    if (not handle.checkSetValidity(getUserInputSize(value), error)) {
+        return false;
+    }
+    // Safe downcast thanks to isParameter check in checkSetValidity
+    auto &parameter = static_cast<const CBaseParameter &>(handle.mElement);
+
+    size_t size = parameter.getFootPrint();
+    if (parameter.getType() == CInstanceConfigurableElement::EBitParameter) {
+
+        // Bit parameters are allocated at their block level, writing one rewrites the block
+        size = static_cast<const CBitParameter &>(parameter).getBelongingBlockSize();
+    }
+    mWrites.push_back(
+        {&handle.mElement, size, [&parameter, value](CParameterAccessContext &context) {
+             // BaseParameter::access takes a non-const argument, the queued value is kept intact
+             T copy = value;
+             return parameter.access(copy, true, context);
+         }});
+    return true;
+}
+
+bool ParameterTransaction::setAsBoolean(const ElementHandle &handle, bool value, string &error)
+{
+    return queue(handle, value, error);
+}
+
+bool ParameterTransaction::setAsBooleanArray(const ElementHandle &handle,
+                                             const std::vector<bool> &value, string &error)
+{
+    return queue(handle, value, error);
+}
+
+bool ParameterTransaction::setAsInteger(const ElementHandle &handle, uint32_t value,
+                                        string &error)
+{
+    return queue(handle, value, error);
+}
+
+bool ParameterTransaction::setAsIntegerArray(const ElementHandle &handle,
+                                             const std::vector<uint32_t> &value, string &error)
+{
+    return queue(handle, value, error);
+}
+
+bool ParameterTransaction::setAsSignedInteger(const ElementHandle &handle, int32_t value,
+                                              string &error)
+{
+    return queue(handle, value, error);
+}
+
+bool ParameterTransaction::setAsSignedIntegerArray(const ElementHandle &handle,
+                                                   const std::vector<int32_t> &value,
+                                                   string &error)
+{
+    return queue(handle, value, error);
+}
+
+bool ParameterTransaction::setAsDouble(const ElementHandle &handle, double value, string &error)
+{
+    return queue(handle, value, error);
+}
+
+bool ParameterTransaction::setAsDoubleArray(const ElementHandle &handle,
+                                            const std::vector<double> &value, string &error)
+{
+    return queue(handle, value, error);
+}
+
+bool ParameterTransaction::setAsString(const ElementHandle &handle, const string &value,
+                                       string &error)
+{
+    return queue(handle, value, error);
+}
+
+bool ParameterTransaction::setAsStringArray(const ElementHandle &handle,
+                                            const std::vector<string> &value, string &error)
+{
+    return queue(handle, value, error);
+}
+
+bool ParameterTransaction::setValue(const string &path, const string &value, string &error)
+{
+    std::unique_ptr<ElementHandle> handle(mParameterMgr.createElementHandle(path, error));
+
+    if (handle == nullptr or not queue(*handle, value, error)) {
+        return false;
+    }
+    mPathHandles.push_back(std::move(handle));
+    return true;
+}
+
+size_t ParameterTransaction::getWriteCount() const
+{
+    return mWrites.size();
+}
+
+void ParameterTransaction::clear()
+{
+    mWrites.clear();
+    mPathHandles.clear();
+}
+
+bool ParameterTransaction::commit(string &error)
+{
+    std::vector<Write> writes;
+    writes.swap(mWrites);
+
+    // When in tuning mode, silently skip "set" requests, as ElementHandle does
+    if (mParameterMgr.tuningModeOn()) {
+
+        clear();
+        return true;
+    }
+    CParameterBlackboard *pBlackboard = mParameterMgr.getParameterBlackboard();
+    CParameterAccessContext parameterAccessContext(error, pBlackboard);
+
+    // Synchronize once all writes are done
+    parameterAccessContext.setAutoSync(false);
+
+    // Ensure we're safe against blackboard foreign access
+    CParameterMgr::CBlackboardLock autoLock(mParameterMgr);
+
+    // Previous content of the written parameters, to restore it on failure
+    std::vector<std::vector<uint8_t>> previousSettings;
+    previousSettings.reserve(writes.size());
+    CSyncerSet syncerSet;
+
+    for (auto &write : writes) {
+
+        previousSettings.emplace_back(write.size);
+        pBlackboard->readBytes(previousSettings.back(), write.element->getOffset());
+
+        if (not write.write(parameterAccessContext)) {
+
+            // Restore in reverse order, so that a parameter written twice gets its first value
+            for (size_t index = previousSettings.size(); index-- > 0;) {
+
+                pBlackboard->writeBytes(previousSettings[index],
+                                        writes[index].element->getOffset());
+            }
+            clear();
+            return false;
+        }
+        write.element->fillSyncerSet(syncerSet);
+    }
+    clear();
+
+    core::Results errors;
+    bool bSynced =
+        syncerSet.sync(*pBlackboard, false, &errors, mParameterMgr._syncThreadPool.get());
+
+    mParameterMgr.publishBlackboardSnapshot();
+
+    if (not bSynced) {
+
+        error = utility::asString(errors);
+        return false;
+    }
+    return true;
+}
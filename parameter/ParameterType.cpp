@@ -31,6 +31,7 @@
 #include "Parameter.h"
 #include "ArrayParameter.h"
 #include "ParameterAccessContext.h"
+#include "BoundParameter.h"
 
 #include <climits>
 
@@ -257,6 +258,12 @@ bool CParameterType::fromBlackboard(int32_t & /*iUserValue*/, uint32_t /*uiValue
     return false;
 }
 
+// Precompiled accessors
+bool CParameterType::getScalarCodec(ScalarCodec & /*codec*/) const
+{
+    return false;
+}
+
 // Double
 bool CParameterType::toBlackboard(double /*dUserValue*/, uint32_t & /*uiValue*/,
                                   CParameterAccessContext &parameterAccessContext) const
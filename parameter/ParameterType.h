@@ -40,6 +40,7 @@
 
 class CParameterAccessContext;
 class CConfigurationAccessContext;
+struct ScalarCodec;
 
 class PARAMETER_EXPORT CParameterType : public CTypeElement
 {
@@ -88,6 +89,13 @@ public:
     virtual bool fromBlackboard(double &dUserValue, uint32_t uiValue,
                                 CParameterAccessContext &parameterAccessContext) const;
 
+    /** Describe the conversions of the type, for precompiled accessors
+     *
+     * @param[out] codec the conversions of the type
+     * @return false if they can not be described by a codec, true otherwise
+     */
+    virtual bool getScalarCodec(ScalarCodec &codec) const;
+
     /** Value space handling for settings import/export from/to XML
      *
      * During export, this method set the "ValueSpace" attribute of the future
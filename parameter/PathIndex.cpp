@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "PathIndex.h"
+#include "ConfigurableElement.h"
+
+#include <algorithm>
+#include <cctype>
+
+using std::string;
+
+void CPathIndex::build(CConfigurableElement &root)
+{
+    clear();
+
+    string strPath = "/" + root.getPathName();
+
+    mElements.emplace(strPath, &root);
+    mKeysSize += strPath.size();
+
+    indexChildren(root, strPath);
+}
+
+void CPathIndex::indexChildren(CConfigurableElement &element, const string &strPath)
+{
+    for (size_t child = 0; child < element.getNbChildren(); child++) {
+
+        auto *pChild = static_cast<CConfigurableElement *>(element.getChild(child));
+        string strChildPath = strPath + "/" + pChild->getPathName();
+
+        // A sibling of the same name hides this child and its descendants
+        if (!mElements.emplace(strChildPath, pChild).second) {
+
+            continue;
+        }
+        mKeysSize += strChildPath.size();
+
+        indexChildren(*pChild, strChildPath);
+    }
+}
+
+void CPathIndex::clear()
+{
+    mElements.clear();
+    mKeysSize = 0;
+}
+
+CConfigurableElement *CPathIndex::find(const string &strPath) const
+{
+    auto it = mElements.find(strPath);
+
+    if (it == mElements.end()) {
+
+        mMisses++;
+        return nullptr;
+    }
+    mHits++;
+    return it->second;
+}
+
+CConfigurableElement *CPathIndex::find(const string &strPath, string &strIndex) const
+{
+    strIndex.clear();
+
+    auto it = mElements.find(strPath);
+
+    if (it == mElements.end()) {
+
+        // Retry without a numerical last item
+        size_t separator = strPath.rfind('/');
+
+        if (separator != string::npos && separator + 1 < strPath.size() &&
+            std::all_of(strPath.begin() + static_cast<std::ptrdiff_t>(separator) + 1,
+                        strPath.end(), [](char c) { return std::isdigit(c) != 0; })) {
+
+            it = mElements.find(strPath.substr(0, separator));
+        }
+        if (it == mElements.end()) {
+
+            mMisses++;
+            return nullptr;
+        }
+        strIndex = strPath.substr(separator + 1);
+    }
+    mHits++;
+    return it->second;
+}
+
+size_t CPathIndex::getSize() const
+{
+    return mElements.size();
+}
+
+size_t CPathIndex::getMemorySize() const
+{
+    // Each node holds its value, the link to the next node and the cached hash of its key
+    using Value = decltype(mElements)::value_type;
+    size_t nodeSize = sizeof(Value) + sizeof(void *) + sizeof(size_t);
+
+    return sizeof(mElements) + mElements.bucket_count() * sizeof(void *) +
+           mElements.size() * nodeSize + mKeysSize;
+}
+
+uint64_t CPathIndex::getHits() const
+{
+    return mHits;
+}
+
+uint64_t CPathIndex::getMisses() const
+{
+    return mMisses;
+}
+
+void CPathIndex::resetStatistics()
+{
+    mHits = 0;
+    mMisses = 0;
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+class CConfigurableElement;
+
+/** Hash index of the configurable elements of a tree, by absolute path
+ *
+ * The index is a cache of the path navigation: it is filled once the structure is loaded and
+ * looking up a path absent from it (not well formed, not found, or with an array index suffix)
+ * has to fall back to the navigation. Lookups are lock free and may be run concurrently.
+ */
+class CPathIndex
+{
+public:
+    /** Index an element and all its descendants
+     *
+     * When siblings share a name, only the first one is reachable by path, as with the
+     * navigation, hence the only one indexed.
+     *
+     * @param[in] root the element whose path is the prefix of all indexed paths
+     */
+    void build(CConfigurableElement &root);
+
+    /** Drop all indexed paths */
+    void clear();
+
+    /** @return the element at the given path, nullptr if not indexed */
+    CConfigurableElement *find(const std::string &strPath) const;
+
+    /** Look an element up, allowing a trailing array index
+     *
+     * @param[in] strPath the path, whose last item may be the index of an array element
+     * @param[out] strIndex the trailing index if the path was found without it, empty otherwise
+     * @return the element at the path, or at the path without its index, nullptr if neither is
+     *         indexed
+     */
+    CConfigurableElement *find(const std::string &strPath, std::string &strIndex) const;
+
+    /** @return the number of indexed paths */
+    size_t getSize() const;
+
+    /** @return an estimation of the memory used by the index, in bytes */
+    size_t getMemorySize() const;
+
+    /** @return the number of lookups which found their element */
+    uint64_t getHits() const;
+
+    /** @return the number of lookups which fell back to the navigation */
+    uint64_t getMisses() const;
+
+    /** Reset the lookup counts */
+    void resetStatistics();
+
+private:
+    /** Index the descendants of an element whose path was indexed */
+    void indexChildren(CConfigurableElement &element, const std::string &strPath);
+
+    std::unordered_map<std::string, CConfigurableElement *> mElements;
+
+    /** Key characters, which the map nodes do not account for */
+    size_t mKeysSize{0};
+
+    mutable std::atomic<uint64_t> mHits{0};
+    mutable std::atomic<uint64_t> mMisses{0};
+};
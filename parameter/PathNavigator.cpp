@@ -30,11 +30,19 @@
 #include "PathNavigator.h"
 #include "Tokenizer.h"
 
+#include <utility>
+
 CPathNavigator::CPathNavigator(const std::string &strPath)
 {
     init(strPath);
 }
 
+CPathNavigator::CPathNavigator(const std::string &strBasePath,
+                               std::vector<std::string> astrItems)
+    : _bValid(true), _strBasePath(strBasePath), _astrItems(std::move(astrItems))
+{
+}
+
 void CPathNavigator::init(const std::string &strPath)
 {
     Tokenizer tokenizer(strPath, "/");
@@ -92,20 +100,17 @@ std::string *CPathNavigator::next()
 
 std::string CPathNavigator::getCurrentPath() const
 {
-    std::string strPath = "/";
-
     if (!_currentIndex) {
 
-        return strPath;
+        return _strBasePath.empty() ? "/" : _strBasePath;
     }
 
-    size_t item;
-    for (item = 0; item < _currentIndex - 1; item++) {
+    std::string strPath = _strBasePath;
 
-        strPath += _astrItems[item] + "/";
-    }
+    for (size_t item = 0; item < _currentIndex; item++) {
 
-    strPath += _astrItems[item];
+        strPath += "/" + _astrItems[item];
+    }
 
     return strPath;
 }
@@ -38,6 +38,13 @@ class CPathNavigator
 public:
     CPathNavigator(const std::string &strPath);
 
+    /** Navigator resuming after an already resolved path
+     *
+     * @param[in] strBasePath the resolved path, prefix of the current path
+     * @param[in] astrItems the items left to navigate through
+     */
+    CPathNavigator(const std::string &strBasePath, std::vector<std::string> astrItems);
+
     // Path validity
     bool isPathValid() const;
 
@@ -55,6 +62,7 @@ private:
     static bool checkPathFormat(const std::string &strUpl);
 
     bool _bValid;
+    std::string _strBasePath;
     std::vector<std::string> _astrItems;
     size_t _currentIndex{0};
 };
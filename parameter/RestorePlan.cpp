@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "RestorePlan.h"
+#include "ParameterBlackboard.h"
+
+void CRestorePlan::clear()
+{
+    mCopies.clear();
+    mMaskedMerges.clear();
+    mSources.clear();
+    mSourcesGeneration = 0;
+    mBuilt = false;
+}
+
+void CRestorePlan::addSource(const CParameterBlackboard &source)
+{
+    mSources.push_back(&source);
+    mSourcesGeneration += source.getGeneration();
+    mBuilt = true;
+}
+
+void CRestorePlan::addCopy(const CParameterBlackboard &source, size_t offset)
+{
+    addSource(source);
+
+    mCopies.push_back({&source, offset});
+}
+
+void CRestorePlan::addMaskedMerge(const CParameterBlackboard &source, size_t offset,
+                                  uint64_t mask)
+{
+    addSource(source);
+
+    mMaskedMerges.push_back({&source, offset, source.getSize(), mask});
+}
+
+uint64_t CRestorePlan::getSourcesGeneration() const
+{
+    uint64_t generation = 0;
+
+    for (const CParameterBlackboard *source : mSources) {
+
+        generation += source->getGeneration();
+    }
+    return generation;
+}
+
+bool CRestorePlan::isUpToDate() const
+{
+    return mBuilt && getSourcesGeneration() == mSourcesGeneration;
+}
+
+void CRestorePlan::execute(CParameterBlackboard &mainBlackboard) const
+{
+    for (const Copy &copy : mCopies) {
+
+        mainBlackboard.restoreFrom(copy.source, copy.destination);
+    }
+    // Beware this code works on little endian architectures only!
+    for (const MaskedMerge &merge : mMaskedMerges) {
+
+        uint64_t uiSrcData = 0;
+        uint64_t uiDstData = 0;
+
+        mainBlackboard.readInteger(&uiDstData, merge.size, merge.destination);
+        merge.source->readInteger(&uiSrcData, merge.size, 0);
+
+        uiDstData = (uiDstData & ~merge.mask) | (uiSrcData & merge.mask);
+
+        mainBlackboard.writeInteger(&uiDstData, merge.size, merge.destination);
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class CParameterBlackboard;
+
+/** Flat restore program of a domain configuration
+ *
+ * Each step refers to the blackboard holding the settings of an area, along with the destination
+ * of the area in the main blackboard. Byte areas are restored by plain copies, bitwise areas by
+ * masked merges of their block.
+ *
+ * The plan does not copy the settings: area blackboards must outlive it. It is out of date as
+ * soon as one of them is modified (or released), which is detected from their generations.
+ */
+class CRestorePlan
+{
+public:
+    /** Drop all steps */
+    void clear();
+
+    /** Append the copy of a whole area
+     *
+     * @param[in] source the area settings
+     * @param[in] offset the area offset in the main blackboard
+     */
+    void addCopy(const CParameterBlackboard &source, size_t offset);
+
+    /** Append the masked merge of a bitwise area
+     *
+     * @param[in] source the area settings, holding the whole bit block
+     * @param[in] offset the bit block offset in the main blackboard
+     * @param[in] mask the bits of the block belonging to the area
+     */
+    void addMaskedMerge(const CParameterBlackboard &source, size_t offset, uint64_t mask);
+
+    /** @return true if steps were appended since last cleared and none of their source was
+     *          modified since */
+    bool isUpToDate() const;
+
+    /** Run the steps onto the main blackboard */
+    void execute(CParameterBlackboard &mainBlackboard) const;
+
+private:
+    /** Record a step source, to check it is unmodified */
+    void addSource(const CParameterBlackboard &source);
+
+    /** Sum of the generations of the sources, which only grows when one of them is modified */
+    uint64_t getSourcesGeneration() const;
+
+    struct Copy
+    {
+        const CParameterBlackboard *source;
+        size_t destination;
+    };
+    struct MaskedMerge
+    {
+        const CParameterBlackboard *source;
+        size_t destination;
+        size_t size;
+        uint64_t mask;
+    };
+
+    std::vector<Copy> mCopies;
+    std::vector<MaskedMerge> mMaskedMerges;
+
+    std::vector<const CParameterBlackboard *> mSources;
+    uint64_t mSourcesGeneration{0};
+    bool mBuilt{false};
+};
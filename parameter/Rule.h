@@ -31,9 +31,14 @@
 
 #include "Element.h"
 
+#include <set>
 #include <string>
 
 class CRuleParser;
+class CRuleProgram;
+class CDomainsBundleWriter;
+class CDomainsBundleReader;
+class CSelectionCriterion;
 
 class CRule : public CElement
 {
@@ -47,4 +52,24 @@ public:
 
     // Rule check
     virtual bool matches() const = 0;
+
+    // Gather the selection criteria this rule depends on
+    virtual void gatherCriteria(std::set<const CSelectionCriterion *> &criteria) const = 0;
+
+    /** Compile the rule into a flat program
+     *
+     * @param[in] program the program to append instructions to
+     * @param[in] onTrue the label to jump to if the rule matches
+     * @param[in] onFalse the label to jump to if the rule does not match
+     */
+    virtual void compile(CRuleProgram &program, size_t onTrue, size_t onFalse) const = 0;
+
+    /** Write the rule to a domains bundle, starting with its domainsBundle::RuleKind */
+    virtual void toBundle(CDomainsBundleWriter &writer) const = 0;
+
+    /** Read the rule from a domains bundle, once its kind has been read
+     *
+     * @return false on error, reported to the reader
+     */
+    virtual bool fromBundle(CDomainsBundleReader &reader) = 0;
 };
@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "RuleBatch.h"
+#include "RuleProgram.h"
+#include "SelectionCriterion.h"
+#include <algorithm>
+#include <assert.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RULE_BATCH_SSE2
+#include <emmintrin.h>
+#endif
+
+// AVX2 is not part of the baseline instruction set: its kernel is compiled for it alone and only
+// selected if the CPU supports it
+#if defined(RULE_BATCH_SSE2) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define RULE_BATCH_AVX2
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace
+{
+
+/** Tests per result word */
+const size_t wordSize = 64;
+
+/** Programs per matching programs bitmap. Walking programs past the first match is wasted work
+ * and the first match is usually found early, hence bitmaps smaller than a word. */
+const size_t searchChunkSize = 8;
+
+size_t findFirstSetBit(uint64_t bits)
+{
+    assert(bits != 0);
+#if defined(__GNUC__)
+    return static_cast<size_t>(__builtin_ctzll(bits));
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, bits);
+    return index;
+#else
+    size_t index = 0;
+    for (; (bits & 1) == 0; bits >>= 1) {
+        index++;
+    }
+    return index;
+#endif
+}
+
+/** Gather the state tested by each test, so that the test pass reads contiguous arrays */
+void gatherStates(const int *states, const uint32_t *slots, size_t count, int *testStates)
+{
+    for (size_t test = 0; test < count; test++) {
+
+        testStates[test] = states[slots[test]];
+    }
+}
+
+/** Set the result bits of count tests, whose tested states are already gathered */
+void scalarCompare(const int *testStates, const int *masks, const int *values, size_t count,
+                   uint64_t *results)
+{
+    for (size_t first = 0; first < count; first += wordSize) {
+
+        size_t end = std::min(count, first + wordSize);
+        uint64_t bits = 0;
+
+        for (size_t test = first; test < end; test++) {
+
+            bits |= static_cast<uint64_t>((testStates[test] & masks[test]) == values[test])
+                    << (test - first);
+        }
+        results[first / wordSize] = bits;
+    }
+}
+
+void scalarTests(const int *states, const uint32_t *slots, const int *masks, const int *values,
+                 size_t count, int *testStates, uint64_t *results)
+{
+    gatherStates(states, slots, count, testStates);
+    scalarCompare(testStates, masks, values, count, results);
+}
+
+#ifdef RULE_BATCH_SSE2
+void sse2Tests(const int *states, const uint32_t *slots, const int *masks, const int *values,
+               size_t count, int *testStates, uint64_t *results)
+{
+    gatherStates(states, slots, count, testStates);
+
+    size_t wordCount = count / wordSize;
+
+    for (size_t word = 0; word < wordCount; word++) {
+
+        uint64_t bits = 0;
+
+        for (size_t lane = 0; lane < wordSize; lane += 4) {
+
+            size_t test = word * wordSize + lane;
+            __m128i state = _mm_loadu_si128(reinterpret_cast<const __m128i *>(testStates + test));
+            __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i *>(masks + test));
+            __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values + test));
+            __m128i equal = _mm_cmpeq_epi32(_mm_and_si128(state, mask), value);
+
+            bits |= static_cast<uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(equal))) << lane;
+        }
+        results[word] = bits;
+    }
+    // Last partial word
+    size_t done = wordCount * wordSize;
+    scalarCompare(testStates + done, masks + done, values + done, count - done,
+                  results + wordCount);
+}
+#endif
+
+#ifdef RULE_BATCH_AVX2
+/** AVX2 gathers the tested states itself, which is faster than gathering them beforehand */
+__attribute__((target("avx2"))) void avx2Tests(const int *states, const uint32_t *slots,
+                                               const int *masks, const int *values,
+                                               size_t count, int *testStates,
+                                               uint64_t *results)
+{
+    size_t wordCount = count / wordSize;
+
+    for (size_t word = 0; word < wordCount; word++) {
+
+        uint64_t bits = 0;
+
+        for (size_t lane = 0; lane < wordSize; lane += 8) {
+
+            size_t test = word * wordSize + lane;
+            __m256i slot = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(slots + test));
+            __m256i state = _mm256_i32gather_epi32(states, slot, sizeof(*states));
+            __m256i mask = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(masks + test));
+            __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + test));
+            __m256i equal = _mm256_cmpeq_epi32(_mm256_and_si256(state, mask), value);
+
+            bits |= static_cast<uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(equal))) << lane;
+        }
+        results[word] = bits;
+    }
+    // Last partial word
+    size_t done = wordCount * wordSize;
+    scalarTests(states, slots + done, masks + done, values + done, count - done,
+                testStates + done, results + wordCount);
+}
+#endif
+
+} // namespace
+
+CRuleBatch::CRuleBatch(bool bVectorized) : mKernel(scalarTests), mInstructionSet("scalar")
+{
+    if (bVectorized) {
+
+#ifdef RULE_BATCH_SSE2
+        mKernel = sse2Tests;
+        mInstructionSet = "SSE2";
+#endif
+#ifdef RULE_BATCH_AVX2
+        if (__builtin_cpu_supports("avx2")) {
+
+            mKernel = avx2Tests;
+            mInstructionSet = "AVX2";
+        }
+#endif
+    }
+    clear();
+}
+
+void CRuleBatch::clear()
+{
+    mSlots.clear();
+    mMasks.clear();
+    mValues.clear();
+    mOnTrue.clear();
+    mOnFalse.clear();
+    mPrograms.clear();
+    mGroups.clear();
+    mCriteria.assign(1, nullptr);
+    mCriterionSlots.clear();
+    mStates.clear();
+    mTestStates.clear();
+    mResults.clear();
+}
+
+size_t CRuleBatch::beginGroup()
+{
+    mGroups.push_back({mPrograms.size(), 0, mSlots.size(), 0, getWordCount()});
+
+    return mGroups.size() - 1;
+}
+
+void CRuleBatch::addProgram(const CRuleProgram &program)
+{
+    assert(!mGroups.empty());
+
+    size_t firstTest = mSlots.size();
+
+    for (const auto &instruction : program.mInstructions) {
+
+        mSlots.push_back(static_cast<uint32_t>(getSlot(program.mCriteria[instruction.slot])));
+        mMasks.push_back(instruction.mask);
+        mValues.push_back(instruction.value);
+        mOnTrue.push_back(static_cast<uint32_t>(instruction.onTrue));
+        mOnFalse.push_back(static_cast<uint32_t>(instruction.onFalse));
+    }
+    mPrograms.push_back({firstTest, program.mInstructions.size()});
+
+    mGroups.back().programCount++;
+    mGroups.back().testCount += program.mInstructions.size();
+}
+
+size_t CRuleBatch::getSlot(const CSelectionCriterion *criterion)
+{
+    if (criterion == nullptr) {
+
+        // Constant state
+        return 0;
+    }
+    auto it = mCriterionSlots.find(criterion);
+
+    if (it != mCriterionSlots.end()) {
+
+        return it->second;
+    }
+    mCriteria.push_back(criterion);
+
+    return mCriterionSlots[criterion] = mCriteria.size() - 1;
+}
+
+size_t CRuleBatch::getWordCount() const
+{
+    if (mGroups.empty()) {
+
+        return 0;
+    }
+    const Group &lastGroup = mGroups.back();
+
+    return lastGroup.firstWord + (lastGroup.testCount + wordSize - 1) / wordSize;
+}
+
+void CRuleBatch::evaluate(const std::vector<size_t> &groups) const
+{
+    mStates.resize(mCriteria.size());
+    mTestStates.resize(mSlots.size());
+    mResults.resize(getWordCount());
+
+    // Slot 0 stays zero
+    mStates[0] = 0;
+
+    for (size_t slot = 1; slot < mCriteria.size(); slot++) {
+
+        mStates[slot] = mCriteria[slot]->getCriterionState();
+    }
+
+    for (size_t group : groups) {
+
+        assert(group < mGroups.size());
+
+        const Group &currentGroup = mGroups[group];
+        size_t first = currentGroup.firstTest;
+
+        mKernel(mStates.data(), mSlots.data() + first, mMasks.data() + first,
+                mValues.data() + first, currentGroup.testCount, mTestStates.data() + first,
+                mResults.data() + currentGroup.firstWord);
+    }
+}
+
+bool CRuleBatch::matches(const Group &group, const Program &program) const
+{
+    const uint64_t *results = mResults.data() + group.firstWord;
+    const uint32_t *onTrue = mOnTrue.data() + program.firstTest;
+    const uint32_t *onFalse = mOnFalse.data() + program.firstTest;
+    size_t pc = 0;
+
+    while (pc < program.testCount) {
+
+        size_t test = program.firstTest - group.firstTest + pc;
+        pc = ((results[test / wordSize] >> (test % wordSize)) & 1) ? onTrue[pc] : onFalse[pc];
+    }
+    return pc == program.testCount;
+}
+
+size_t CRuleBatch::findFirstMatch(size_t group) const
+{
+    assert(group < mGroups.size());
+    assert(mResults.size() == getWordCount());
+
+    const Group &currentGroup = mGroups[group];
+    const Program *programs = mPrograms.data() + currentGroup.firstProgram;
+
+    // Bitmap of the matching programs, a chunk at a time so that the search stops at the first
+    // chunk holding a match
+    for (size_t first = 0; first < currentGroup.programCount; first += searchChunkSize) {
+
+        size_t end = std::min(currentGroup.programCount, first + searchChunkSize);
+        uint64_t matching = 0;
+
+        for (size_t index = first; index < end; index++) {
+
+            matching |= static_cast<uint64_t>(matches(currentGroup, programs[index]))
+                        << (index - first);
+        }
+        if (matching != 0) {
+
+            return first + findFirstSetBit(matching);
+        }
+    }
+    return currentGroup.programCount;
+}
+
+const char *CRuleBatch::getInstructionSet() const
+{
+    return mInstructionSet;
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+class CRuleProgram;
+class CSelectionCriterion;
+
+/** Batch evaluator of rule programs
+ *
+ * The tests of every program are laid out as structure of arrays, grouped (typically one group
+ * per domain, holding its configurations rules in priority order). evaluate() gathers the
+ * criteria states, then runs the tests of the given groups in a compare-and-mask pass per group
+ * (SSE2 or AVX2 when available, scalar otherwise) into the group bitmap of test results. A group
+ * is then searched by walking its programs jump tables over that bitmap, which yields bitmaps of
+ * its matching programs whose first set bit is the searched program.
+ */
+class CRuleBatch
+{
+public:
+    /** @param[in] bVectorized false to always use the scalar test pass, for comparison */
+    explicit CRuleBatch(bool bVectorized = true);
+
+    /** Drop all groups and programs */
+    void clear();
+
+    /** Start a new group, programs added afterwards belong to it
+     *
+     * @return the group index
+     */
+    size_t beginGroup();
+
+    /** Append a program to the current group */
+    void addProgram(const CRuleProgram &program);
+
+    /** Run the tests of some groups against the current criteria states
+     *
+     * @param[in] groups the indexes of the groups to be searched afterwards
+     */
+    void evaluate(const std::vector<size_t> &groups) const;
+
+    /** Search the first matching program of a group
+     *
+     * @param[in] group the group index, evaluated since the criteria states last changed
+     * @return the index in the group of the first matching program, the group program count if
+     *         none matches
+     */
+    size_t findFirstMatch(size_t group) const;
+
+    /** @return the name of the instruction set used by the test pass */
+    const char *getInstructionSet() const;
+
+private:
+    struct Program
+    {
+        /** Index of the first test of the program */
+        size_t firstTest;
+        size_t testCount;
+    };
+
+    struct Group
+    {
+        /** Index of the first program of the group */
+        size_t firstProgram;
+        size_t programCount;
+        /** Index of the first test of the group */
+        size_t firstTest;
+        size_t testCount;
+        /** Index of the first word of the group test results, groups not sharing words */
+        size_t firstWord;
+    };
+
+    /** Test pass: sets bit i of results if (states[slots[i]] & masks[i]) == values[i], using
+     * testStates as scratch space */
+    using Kernel = void (*)(const int *states, const uint32_t *slots, const int *masks,
+                            const int *values, size_t count, int *testStates, uint64_t *results);
+
+    /** Slot of a criterion in the packed state array, allocating it if needed */
+    size_t getSlot(const CSelectionCriterion *criterion);
+
+    /** @return whether a program of a group matches, given the group test results */
+    bool matches(const Group &group, const Program &program) const;
+
+    /** @return the number of result words of all groups */
+    size_t getWordCount() const;
+
+    /// Tests, as structure of arrays
+    std::vector<uint32_t> mSlots;
+    std::vector<int> mMasks;
+    std::vector<int> mValues;
+    /** Jump targets, relative to the program first test */
+    std::vector<uint32_t> mOnTrue;
+    std::vector<uint32_t> mOnFalse;
+
+    std::vector<Program> mPrograms;
+    std::vector<Group> mGroups;
+
+    /** Criteria referenced by the tests, slot 0 being reserved for a constant state */
+    std::vector<const CSelectionCriterion *> mCriteria;
+    std::map<const CSelectionCriterion *, size_t> mCriterionSlots;
+
+    Kernel mKernel;
+    const char *mInstructionSet;
+
+    /** Scratch arrays: packed criteria states, state tested by each test and test results */
+    mutable std::vector<int> mStates;
+    mutable std::vector<int> mTestStates;
+    mutable std::vector<uint64_t> mResults;
+};
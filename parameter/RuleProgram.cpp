@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "RuleProgram.h"
+#include "Rule.h"
+#include "SelectionCriterion.h"
+#include <algorithm>
+#include <assert.h>
+
+namespace
+{
+/** Labels created before compiling the rule: the program result */
+const size_t matchLabel = 0;
+const size_t mismatchLabel = 1;
+} // namespace
+
+CRuleProgram::CRuleProgram()
+{
+    compile(nullptr);
+}
+
+void CRuleProgram::compile(const CRule *rule)
+{
+    mInstructions.clear();
+    mLabels.clear();
+    mCriteria.assign(1, nullptr);
+
+    createLabel(); // matchLabel
+    createLabel(); // mismatchLabel
+
+    if (rule != nullptr) {
+
+        rule->compile(*this, matchLabel, mismatchLabel);
+    } else {
+
+        addJump(mismatchLabel);
+    }
+
+    // Matching is falling off the end of the program, mismatching is jumping past it
+    mLabels[matchLabel] = mInstructions.size();
+    mLabels[mismatchLabel] = mInstructions.size() + 1;
+
+    // Resolve labels
+    for (auto &instruction : mInstructions) {
+
+        instruction.onTrue = mLabels[instruction.onTrue];
+        instruction.onFalse = mLabels[instruction.onFalse];
+    }
+    mLabels.clear();
+
+    mStates.assign(mCriteria.size(), 0);
+}
+
+bool CRuleProgram::matches() const
+{
+    // Pack criteria states, slot 0 stays zero
+    for (size_t slot = 1; slot < mCriteria.size(); slot++) {
+
+        mStates[slot] = mCriteria[slot]->getCriterionState();
+    }
+
+    const Instruction *instructions = mInstructions.data();
+    const int *states = mStates.data();
+    size_t end = mInstructions.size();
+    size_t pc = 0;
+
+    while (pc < end) {
+
+        const Instruction &instruction = instructions[pc];
+
+        pc = (states[instruction.slot] & instruction.mask) == instruction.value
+                 ? instruction.onTrue
+                 : instruction.onFalse;
+    }
+    return pc == end;
+}
+
+size_t CRuleProgram::createLabel()
+{
+    mLabels.push_back(0);
+
+    return mLabels.size() - 1;
+}
+
+void CRuleProgram::bindLabel(size_t label)
+{
+    assert(label < mLabels.size());
+
+    mLabels[label] = mInstructions.size();
+}
+
+void CRuleProgram::addTest(const CSelectionCriterion *criterion, int mask, int value,
+                           size_t onTrue, size_t onFalse)
+{
+    assert(criterion != nullptr);
+
+    // Allocate the criterion a slot in the packed state array if not already done
+    auto it = std::find(mCriteria.begin() + 1, mCriteria.end(), criterion);
+    size_t slot = it - mCriteria.begin();
+
+    if (it == mCriteria.end()) {
+
+        mCriteria.push_back(criterion);
+    }
+    mInstructions.push_back({slot, mask, value, onTrue, onFalse});
+}
+
+void CRuleProgram::addJump(size_t target)
+{
+    // Slot 0 always holds 0, hence this test always succeeds
+    mInstructions.push_back({0, 0, 0, target, target});
+}
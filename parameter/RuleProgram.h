@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+class CRule;
+class CSelectionCriterion;
+
+/** Flat, precompiled form of an application rule tree
+ *
+ * The rule tree is compiled into a contiguous array of tests. Each test checks
+ * "(criterion state & mask) == value" and jumps to one of two targets depending on the
+ * outcome, which implements the Any/All short-circuits. Reaching the end of the program means
+ * the rule matches, jumping past it means it does not.
+ */
+class CRuleProgram
+{
+public:
+    /** Create a program that never matches */
+    CRuleProgram();
+
+    /** Compile a rule tree, replacing any previous program
+     *
+     * @param[in] rule the root rule, a null rule never matches
+     */
+    void compile(const CRule *rule);
+
+    /** Evaluate the program against the current criteria states */
+    bool matches() const;
+
+    /// Compilation helpers, to be used by CRule::compile implementations
+
+    /** @return a new label, to be bound later on with bindLabel() */
+    size_t createLabel();
+
+    /** Make the label point to the next instruction to be added */
+    void bindLabel(size_t label);
+
+    /** Add a test instruction
+     *
+     * @param[in] criterion the criterion whose state is tested
+     * @param[in] mask the mask applied to the criterion state
+     * @param[in] value the value the masked state is compared to
+     * @param[in] onTrue the label to jump to if the test succeeds
+     * @param[in] onFalse the label to jump to if the test fails
+     */
+    void addTest(const CSelectionCriterion *criterion, int mask, int value, size_t onTrue,
+                 size_t onFalse);
+
+    /** Add an unconditional jump to the given label */
+    void addJump(size_t target);
+
+private:
+    struct Instruction
+    {
+        /** Index in the packed state array */
+        size_t slot;
+        int mask;
+        int value;
+        /** Labels while compiling, instruction indexes once resolved */
+        size_t onTrue;
+        size_t onFalse;
+    };
+
+    std::vector<Instruction> mInstructions;
+
+    /** Label to instruction index, used while compiling */
+    std::vector<size_t> mLabels;
+
+    /** Criteria referenced by the program, slot 0 being reserved for a constant state */
+    std::vector<const CSelectionCriterion *> mCriteria;
+
+    /** Scratch array the criteria states are packed into before evaluation */
+    mutable std::vector<int> mStates;
+
+    /** Lays out programs tests for batch evaluation */
+    friend class CRuleBatch;
+};
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "BoundParameter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+/** Conversions between user values and blackboard encodings, as described by a ScalarCodec
+ *
+ * Inline so that the typed accessors convert values without calls to the parameter types.
+ */
+namespace scalarCodec
+{
+
+/** Sign extend an encoded value, as CParameterType::signExtend */
+inline int32_t signExtend(uint32_t data, size_t size)
+{
+    uint32_t shift = static_cast<uint32_t>(8 * (sizeof(data) - size));
+
+    return static_cast<int32_t>(data << shift) >> shift;
+}
+
+/** Integer adaptation, as CParameterAdaptation::fromUserValue and its derived classes */
+inline int64_t fromUserValue(const ScalarCodec &codec, double value)
+{
+    switch (codec.adaptation) {
+    case ScalarCodec::Adaptation::Logarithmic: {
+        double linear = log(value) / log(codec.logarithmBase);
+        int64_t encoded =
+            static_cast<int64_t>(linear * codec.slopeNumerator / codec.slopeDenominator) +
+            codec.offset;
+        return std::max(encoded, static_cast<int64_t>(codec.floorValue));
+    }
+    case ScalarCodec::Adaptation::Linear:
+        return static_cast<int64_t>(value * codec.slopeNumerator / codec.slopeDenominator) +
+               codec.offset;
+    default:
+        return static_cast<int64_t>(value) + codec.offset;
+    }
+}
+
+/** Integer adaptation, as CParameterAdaptation::toUserValue and its derived classes */
+inline double toUserValue(const ScalarCodec &codec, int64_t encoded)
+{
+    double value = static_cast<double>(encoded - codec.offset);
+
+    switch (codec.adaptation) {
+    case ScalarCodec::Adaptation::Logarithmic:
+        return exp(value * codec.slopeDenominator / codec.slopeNumerator *
+                   log(codec.logarithmBase));
+    case ScalarCodec::Adaptation::Linear:
+        return value * codec.slopeDenominator / codec.slopeNumerator;
+    default:
+        return value;
+    }
+}
+
+/** Fixed point decoding, as CFixedPointParameterType::binaryQnmToDouble */
+inline double fixedPointToUserValue(const ScalarCodec &codec, uint32_t data)
+{
+    return static_cast<double>(signExtend(data, codec.size) >> codec.justification) /
+           double(1UL << codec.fractional);
+}
+
+/** Floating point decoding */
+inline double floatingPointToUserValue(uint32_t data)
+{
+    float value;
+    memcpy(&value, &data, sizeof(value));
+    return value;
+}
+
+} // namespace scalarCodec
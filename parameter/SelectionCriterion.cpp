@@ -62,10 +62,10 @@ void CSelectionCriterion::resetModifiedStatus()
 // State
 void CSelectionCriterion::setCriterionState(int iState)
 {
-    // Check for a change
-    if (_iState != iState) {
+    uint32_t uiNbModifications = _uiNbModifications;
 
-        _iState = iState;
+    // Check for a change
+    if (updateCriterionState(iState)) {
 
         _logger.info() << "Selection criterion changed event: "
                        << getFormattedDescription(false, false);
@@ -73,16 +73,28 @@ void CSelectionCriterion::setCriterionState(int iState)
         // Check if the previous criterion value has been taken into account (i.e. at least one
         // Configuration was applied
         // since the last criterion change)
-        if (_uiNbModifications != 0) {
+        if (uiNbModifications != 0) {
 
             _logger.warning() << "Selection criterion '" << getName() << "' has been modified "
-                              << _uiNbModifications
+                              << uiNbModifications
                               << " time(s) without any configuration application";
         }
+    }
+}
 
-        // Track the number of modifications for this criterion
-        _uiNbModifications++;
+bool CSelectionCriterion::updateCriterionState(int iState)
+{
+    // Check for a change
+    if (_iState == iState) {
+
+        return false;
     }
+    _iState = iState;
+
+    // Track the number of modifications for this criterion
+    _uiNbModifications++;
+
+    return true;
 }
 
 int CSelectionCriterion::getCriterionState() const
@@ -48,6 +48,12 @@ public:
     /// From ISelectionCriterionInterface
     // State
     void setCriterionState(int iState) override;
+    /** Set the state without logging
+     *
+     * @param[in] iState the new state
+     * @return true if the state changed, false otherwise
+     */
+    bool updateCriterionState(int iState);
     int getCriterionState() const override;
     // Name
     std::string getCriterionName() const override;
@@ -34,6 +34,8 @@
 #include "SelectionCriteriaDefinition.h"
 #include "SelectionCriterionTypeInterface.h"
 #include "RuleParser.h"
+#include "RuleProgram.h"
+#include "DomainsBundle.h"
 #include <assert.h>
 
 #define base CRule
@@ -139,6 +141,38 @@ bool CSelectionCriterionRule::matches() const
     }
 }
 
+// Criteria dependencies
+void CSelectionCriterionRule::gatherCriteria(std::set<const CSelectionCriterion *> &criteria) const
+{
+    assert(_pSelectionCriterion);
+
+    criteria.insert(_pSelectionCriterion);
+}
+
+// Rule compilation
+void CSelectionCriterionRule::compile(CRuleProgram &program, size_t onTrue, size_t onFalse) const
+{
+    assert(_pSelectionCriterion);
+
+    // All matching rules boil down to comparing the masked criterion state to a value
+    switch (_eMatchesWhen) {
+    case EIs:
+        program.addTest(_pSelectionCriterion, ~0, _iMatchValue, onTrue, onFalse);
+        break;
+    case EIsNot:
+        program.addTest(_pSelectionCriterion, ~0, _iMatchValue, onFalse, onTrue);
+        break;
+    case EIncludes:
+        program.addTest(_pSelectionCriterion, _iMatchValue, _iMatchValue, onTrue, onFalse);
+        break;
+    case EExcludes:
+        program.addTest(_pSelectionCriterion, _iMatchValue, 0, onTrue, onFalse);
+        break;
+    default:
+        assert(0);
+    }
+}
+
 // From IXmlSink
 bool CSelectionCriterionRule::fromXml(const CXmlElement &xmlElement,
                                       CXmlSerializingContext &serializingContext)
@@ -248,3 +282,58 @@ bool CSelectionCriterionRule::setMatchesWhen(const string &strMatchesWhen, strin
 
     return false;
 }
+
+// Domains bundle serialization
+void CSelectionCriterionRule::toBundle(CDomainsBundleWriter &writer) const
+{
+    assert(_pSelectionCriterion);
+
+    writer.write(domainsBundle::ESelectionCriterionRule);
+    writer.writeString(_pSelectionCriterion->getName());
+    writer.write(static_cast<uint8_t>(_eMatchesWhen));
+
+    // Store the literal value, as numerical values are given by the client at each start
+    string strValue;
+
+    _pSelectionCriterion->getCriterionType()->getLiteralValue(_iMatchValue, strValue);
+
+    writer.writeString(strValue);
+}
+
+bool CSelectionCriterionRule::fromBundle(CDomainsBundleReader &reader)
+{
+    string strSelectionCriterion;
+    uint8_t matchesWhen;
+    string strValue;
+
+    if (!reader.readString(strSelectionCriterion) || !reader.read(matchesWhen) ||
+        !reader.readString(strValue)) {
+
+        return false;
+    }
+    _pSelectionCriterion =
+        reader.getSelectionCriteriaDefinition()->getSelectionCriterion(strSelectionCriterion);
+
+    if (!_pSelectionCriterion) {
+
+        return reader.fail("Couldn't find selection criterion " + strSelectionCriterion +
+                           " in domains bundle");
+    }
+    if (matchesWhen >= ENbMatchesWhen) {
+
+        return reader.fail("Invalid matching rule in domains bundle");
+    }
+    string strError;
+
+    if (!setMatchesWhen(_astMatchesWhen[matchesWhen].pcMatchesWhen, strError)) {
+
+        return reader.fail("Wrong matching rule for criterion " + strSelectionCriterion +
+                           " in domains bundle: " + strError);
+    }
+    if (!_pSelectionCriterion->getCriterionType()->getNumericalValue(strValue, _iMatchValue)) {
+
+        return reader.fail("Wrong value " + strValue + " for criterion " +
+                           strSelectionCriterion + " in domains bundle");
+    }
+    return true;
+}
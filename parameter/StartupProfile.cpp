@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "StartupProfile.h"
+#include "HeapUsage.hpp"
+
+#include <cassert>
+#include <cstdio>
+
+using std::string;
+
+namespace
+{
+
+string quote(const string &value)
+{
+    string quoted = "\"";
+
+    for (char character : value) {
+
+        switch (character) {
+        case '"':
+            quoted += "\\\"";
+            break;
+        case '\\':
+            quoted += "\\\\";
+            break;
+        default:
+            if (static_cast<unsigned char>(character) < 0x20) {
+
+                char escaped[7];
+                snprintf(escaped, sizeof(escaped), "\\u%04x", character);
+                quoted += escaped;
+            } else {
+
+                quoted += character;
+            }
+        }
+    }
+    return quoted + "\"";
+}
+
+} // namespace
+
+CStartupProfile::CPhase::CPhase(CStartupProfile &profile, const string &name) : mProfile(profile)
+{
+    mProfile.startPhase(name);
+}
+
+CStartupProfile::CPhase::~CPhase()
+{
+    mProfile.endPhase();
+}
+
+void CStartupProfile::clear()
+{
+    mPhases.clear();
+}
+
+void CStartupProfile::addDetail(const string &breakdown, const string &item, Duration duration)
+{
+    assert(!mPhases.empty());
+
+    mPhases.back().breakdowns[breakdown].push_back({item, duration});
+}
+
+void CStartupProfile::startPhase(const string &name)
+{
+    mPhases.emplace_back();
+    mPhases.back().name = name;
+
+    mStartHeapKnown = utility::getHeapInUse(mStartHeap);
+    mStart = Clock::now();
+}
+
+void CStartupProfile::endPhase()
+{
+    Phase &phase = mPhases.back();
+
+    phase.duration = std::chrono::duration_cast<Duration>(Clock::now() - mStart);
+
+    uint64_t heap;
+
+    if (mStartHeapKnown && utility::getHeapInUse(heap)) {
+
+        phase.bHeapKnown = true;
+        phase.heapGrowth = static_cast<int64_t>(heap) - static_cast<int64_t>(mStartHeap);
+    }
+}
+
+string CStartupProfile::toJson() const
+{
+    Duration total{0};
+    string phases;
+
+    for (const auto &phase : mPhases) {
+
+        total += phase.duration;
+
+        string breakdowns;
+
+        for (const auto &breakdown : phase.breakdowns) {
+
+            string details;
+
+            for (const auto &detail : breakdown.second) {
+
+                details += string(details.empty() ? "" : ", ") + "{\"name\": " +
+                           quote(detail.name) +
+                           ", \"duration\": " + std::to_string(detail.duration.count()) + "}";
+            }
+            breakdowns += string(breakdowns.empty() ? "" : ", ") + quote(breakdown.first) +
+                          ": [" + details + "]";
+        }
+        phases += string(phases.empty() ? "" : ", ") + "{\"name\": " + quote(phase.name) +
+                  ", \"duration\": " + std::to_string(phase.duration.count()) +
+                  ", \"heapGrowth\": " +
+                  (phase.bHeapKnown ? std::to_string(phase.heapGrowth) : "null") +
+                  ", \"breakdowns\": {" + breakdowns + "}}";
+    }
+    return "{\"total\": " + std::to_string(total.count()) + ", \"phases\": [" + phases + "]}";
+}
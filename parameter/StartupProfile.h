@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "NonCopyable.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+/** Durations and heap growth of the startup phases, reported in JSON
+ *
+ * Phases are sequential. Each one may break its duration down per item (subsystem, file...)
+ * in named breakdowns. Heap growth is the difference of the heap in use at the phase end and
+ * start, when reported by the allocator.
+ */
+class CStartupProfile : private utility::NonCopyable
+{
+public:
+    using Duration = std::chrono::microseconds;
+
+    /** Times a phase during its lifetime */
+    class CPhase : private utility::NonCopyable
+    {
+    public:
+        CPhase(CStartupProfile &profile, const std::string &name);
+        ~CPhase();
+
+    private:
+        CStartupProfile &mProfile;
+    };
+
+    /** Forget all phases */
+    void clear();
+
+    /** Record the duration of an item of the current phase
+     *
+     * @param[in] breakdown the breakdown name, such as "files"
+     * @param[in] item the item name, such as a file URI
+     * @param[in] duration the time spent on the item
+     */
+    void addDetail(const std::string &breakdown, const std::string &item, Duration duration);
+
+    /** @return the phases, their durations in microseconds and heap growth in bytes, as:
+     * {"total": us, "phases": [{"name": "...", "duration": us, "heapGrowth": bytes or null,
+     *  "breakdowns": {"<breakdown>": [{"name": "...", "duration": us}, ...]}}, ...]}
+     */
+    std::string toJson() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Detail
+    {
+        std::string name;
+        Duration duration;
+    };
+    struct Phase
+    {
+        std::string name;
+        Duration duration{0};
+        bool bHeapKnown{false};
+        int64_t heapGrowth{0};
+        std::map<std::string, std::vector<Detail>> breakdowns;
+    };
+
+    void startPhase(const std::string &name);
+    void endPhase();
+
+    std::vector<Phase> mPhases;
+
+    /** Current phase start */
+    Clock::time_point mStart;
+    bool mStartHeapKnown{false};
+    uint64_t mStartHeap{0};
+};
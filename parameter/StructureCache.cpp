@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "StructureCache.h"
+#include "XmlDocSource.h"
+#include "XmlBinaryDoc.h"
+#include "MappedFile.hpp"
+#include "Fnv1aHash.hpp"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+using std::string;
+
+namespace
+{
+
+const char gMagic[4] = {'P', 'F', 'W', 'S'};
+const uint32_t gVersion = 1;
+
+// Structure inclusions, see CXmlFileIncluderElement
+const char gIncludeType[] = "SubsystemInclude";
+
+} // namespace
+
+CStructureCache::CStructureCache(const string &cachePath, const string &structureUri)
+    : mCachePath(cachePath), mStructureUri(structureUri)
+{
+}
+
+_xmlDoc *CStructureCache::load(bool bValidated, string &strError) const
+{
+    try {
+        MappedFile cache(mCachePath);
+        utility::BinaryReader reader(cache.getData(), cache.getSize());
+
+        const uint8_t *magic = reader.readBytes(sizeof(gMagic));
+        uint32_t version;
+
+        if (magic == nullptr || memcmp(magic, gMagic, sizeof(gMagic)) || !reader.read(version) ||
+            version != gVersion) {
+
+            strError = "Not a structure cache of version " + std::to_string(gVersion);
+            return nullptr;
+        }
+        string structureUri;
+        uint8_t validated;
+        uint32_t nbSources;
+
+        if (!reader.readString(structureUri) || !reader.read(validated) ||
+            !reader.read(nbSources)) {
+
+            strError = "Truncated structure cache";
+            return nullptr;
+        }
+        if (structureUri != mStructureUri) {
+
+            strError = "Structure cache built for " + structureUri;
+            return nullptr;
+        }
+        if (bValidated && !validated) {
+
+            strError = "Structure cache built without schema validation";
+            return nullptr;
+        }
+        std::vector<string> sourceUris;
+        uint64_t hash;
+
+        for (uint32_t source = 0; source < nbSources; source++) {
+
+            string sourceUri;
+
+            if (!reader.readString(sourceUri)) {
+
+                strError = "Truncated structure cache";
+                return nullptr;
+            }
+            sourceUris.push_back(sourceUri);
+        }
+        uint64_t sourcesHash;
+
+        if (!reader.read(hash) || !hashSources(sourceUris, sourcesHash, strError)) {
+
+            if (strError.empty()) {
+
+                strError = "Truncated structure cache";
+            }
+            return nullptr;
+        }
+        if (hash != sourcesHash) {
+
+            strError = "Structure description files changed since the cache has been built";
+            return nullptr;
+        }
+        _xmlDoc *doc = CXmlBinaryDoc::deserialize(reader);
+
+        if (doc == nullptr) {
+
+            strError = "Corrupted structure cache";
+        }
+        return doc;
+
+    } catch (std::runtime_error &e) {
+
+        strError = e.what();
+        return nullptr;
+    }
+}
+
+_xmlDoc *CStructureCache::parse(CXmlSerializingContext &serializingContext)
+{
+    mSourceUris.clear();
+    mDoc = utility::BinaryWriter();
+
+    _xmlDoc *doc = CXmlDocSource::mkExpandedXmlDoc(mStructureUri, gIncludeType, mSourceUris,
+                                                    serializingContext);
+
+    if (doc != nullptr) {
+
+        // The structure is built from the document in place, serialize it beforehand
+        CXmlBinaryDoc::serialize(doc, mDoc);
+    }
+    return doc;
+}
+
+bool CStructureCache::store(bool bValidated, string &strError) const
+{
+    uint64_t sourcesHash;
+
+    if (!hashSources(mSourceUris, sourcesHash, strError)) {
+
+        return false;
+    }
+    utility::BinaryWriter writer;
+
+    writer.writeBytes(gMagic, sizeof(gMagic));
+    writer.write(gVersion);
+    writer.writeString(mStructureUri);
+    writer.write(static_cast<uint8_t>(bValidated));
+    writer.write(static_cast<uint32_t>(mSourceUris.size()));
+
+    for (const auto &sourceUri : mSourceUris) {
+
+        writer.writeString(sourceUri);
+    }
+    writer.write(sourcesHash);
+
+    // Write to a temporary file first so that a concurrent start never reads a partial cache
+    string temporaryPath = mCachePath + ".tmp";
+    {
+        std::ofstream output(temporaryPath, std::ios::binary);
+
+        const auto &header = writer.getData();
+        const auto &doc = mDoc.getData();
+
+        if (!output.write(reinterpret_cast<const char *>(header.data()),
+                          static_cast<std::streamsize>(header.size())) ||
+            !output.write(reinterpret_cast<const char *>(doc.data()),
+                          static_cast<std::streamsize>(doc.size()))) {
+
+            strError = "Could not write structure cache " + temporaryPath;
+            return false;
+        }
+    }
+    // Renaming over an existing file fails on some platforms
+    if (std::rename(temporaryPath.c_str(), mCachePath.c_str()) != 0 &&
+        (std::remove(mCachePath.c_str()) != 0 ||
+         std::rename(temporaryPath.c_str(), mCachePath.c_str()) != 0)) {
+
+        std::remove(temporaryPath.c_str());
+        strError = "Could not write structure cache " + mCachePath;
+        return false;
+    }
+    return true;
+}
+
+bool CStructureCache::hashSources(const std::vector<string> &sourceUris, uint64_t &hash,
+                                  string &strError)
+{
+    utility::Fnv1aHash sourcesHash;
+
+    for (const auto &sourceUri : sourceUris) {
+
+        string sourcePath = CXmlDocSource::mkPath(sourceUri);
+
+        if (sourcePath.empty()) {
+
+            strError = "Structure description file " + sourceUri + " is not a local file";
+            return false;
+        }
+        try {
+            MappedFile source(sourcePath);
+
+            sourcesHash.addString(sourceUri);
+            sourcesHash.addInteger(source.getSize());
+            sourcesHash.addBytes(source.getData(), source.getSize());
+
+        } catch (std::runtime_error &e) {
+
+            strError = e.what();
+            return false;
+        }
+    }
+    hash = sourcesHash.get();
+    return true;
+}
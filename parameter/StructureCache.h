@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "NonCopyable.hpp"
+#include "BinaryBuffer.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct _xmlDoc;
+class CXmlSerializingContext;
+
+/** Cache of the structure description
+ *
+ * The structure description files, XIncluded and subsystem included ones, are compiled to a
+ * single document, stored in binary form along with the list of those files and the hash of
+ * their content. As long as none of them changes, the document is loaded from the cache instead
+ * of being read, parsed and validated again.
+ *
+ * Subsystems being plugin defined, the cache holds the document rather than the elements
+ * instantiated from it: parsing the files is skipped, not building the structure from the
+ * document.
+ */
+class CStructureCache : private utility::NonCopyable
+{
+public:
+    /**
+     * @param[in] cachePath the path of the cache file
+     * @param[in] structureUri the URI of the structure description file
+     */
+    CStructureCache(const std::string &cachePath, const std::string &structureUri);
+
+    /** Load the structure document from the cache
+     *
+     * @param[in] bValidated whether the document must have been validated against the schemas
+     * @param[out] strError the reason why the cache can not be used
+     * @return the document, nullptr if the cache is missing or out of date
+     */
+    _xmlDoc *load(bool bValidated, std::string &strError) const;
+
+    /** Read the structure description files to a single document, to be stored afterwards
+     *
+     * @param[in] serializingContext will receive any parsing error
+     * @return the document, nullptr on error
+     */
+    _xmlDoc *parse(CXmlSerializingContext &serializingContext);
+
+    /** Store the document returned by parse to the cache file
+     *
+     * To be called once the structure has been successfully built from the document only, so
+     * that invalid documents are never cached.
+     *
+     * @param[in] bValidated whether the document has been validated against the schemas
+     * @param[out] strError the reason of the failure
+     * @return true if succeed false otherwise
+     */
+    bool store(bool bValidated, std::string &strError) const;
+
+private:
+    /** Hash the content of the files
+     *
+     * @return true if succeed false if a file could not be read
+     */
+    static bool hashSources(const std::vector<std::string> &sourceUris, uint64_t &hash,
+                            std::string &strError);
+
+    std::string mCachePath;
+    std::string mStructureUri;
+
+    /** Files the document returned by parse is made of */
+    std::vector<std::string> mSourceUris;
+
+    /** Binary form of the document returned by parse */
+    utility::BinaryWriter mDoc;
+};
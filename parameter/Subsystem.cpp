@@ -35,6 +35,7 @@
 #include "ConfigurationAccessContext.h"
 #include "SubsystemObjectCreator.h"
 #include "MappingData.h"
+#include "LatencyHistogram.hpp"
 #include <assert.h>
 #include <sstream>
 
@@ -45,7 +46,8 @@ using std::list;
 
 CSubsystem::CSubsystem(const string &strName, core::log::Logger &logger)
     : base(strName), _pComponentLibrary(new CComponentLibrary),
-      _pInstanceDefinition(new CInstanceDefinition), _logger(logger)
+      _pInstanceDefinition(new CInstanceDefinition), _logger(logger),
+      _syncLatency(new utility::LatencyHistogram)
 {
     // Note: A subsystem contains instance components
     // InstanceDefintion and ComponentLibrary objects are then not chosen to be children
@@ -91,6 +93,57 @@ bool CSubsystem::needResync(bool /*bClear*/)
     return false;
 }
 
+bool CSubsystem::isConcurrentSyncAllowed() const
+{
+    return _bConcurrentSyncAllowed;
+}
+
+void CSubsystem::setConcurrentSyncAllowed(bool bAllowed)
+{
+    _bConcurrentSyncAllowed = bAllowed;
+}
+
+std::mutex &CSubsystem::getAccessMutex() const
+{
+    return _accessMutex;
+}
+
+void CSubsystem::countSync(bool bPerformed) const
+{
+    (bPerformed ? _uiPerformedSyncs : _uiSkippedSyncs).fetch_add(1, std::memory_order_relaxed);
+}
+
+string CSubsystem::getSyncStatistics() const
+{
+    return std::to_string(_uiPerformedSyncs.load(std::memory_order_relaxed)) + " performed, " +
+           std::to_string(_uiSkippedSyncs.load(std::memory_order_relaxed)) + " skipped syncs";
+}
+
+void CSubsystem::setSyncLatencyRecorded(bool bRecorded)
+{
+    _bSyncLatencyRecorded = bRecorded;
+}
+
+utility::LatencyHistogram *CSubsystem::getSyncLatencyRecorder() const
+{
+    return _bSyncLatencyRecorded ? _syncLatency.get() : nullptr;
+}
+
+const utility::LatencyHistogram &CSubsystem::getSyncLatency() const
+{
+    return *_syncLatency;
+}
+
+std::chrono::microseconds CSubsystem::getMappingDuration() const
+{
+    return _mappingDuration;
+}
+
+void CSubsystem::resetSyncLatency()
+{
+    _syncLatency->reset();
+}
+
 bool CSubsystem::structureFromXml(const CXmlElement &xmlElement,
                                   CXmlSerializingContext &serializingContext)
 {
@@ -144,7 +197,13 @@ bool CSubsystem::structureFromXml(const CXmlElement &xmlElement,
 
     // Execute mapping to create subsystem mapping entities
     string strError;
-    if (!mapSubsystemElements(strError)) {
+    auto mappingStart = std::chrono::steady_clock::now();
+    bool bMapped = mapSubsystemElements(strError);
+
+    _mappingDuration = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - mappingStart);
+
+    if (!bMapped) {
 
         serializingContext.setError(strError);
 
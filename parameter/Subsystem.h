@@ -36,7 +36,12 @@
 #include "MappingContext.h"
 #include <log/Logger.h>
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <list>
+#include <memory>
+#include <mutex>
 #include <stack>
 #include <string>
 #include <vector>
@@ -48,6 +53,11 @@ class CSubsystemObjectCreator;
 class CInstanceConfigurableElement;
 class CMappingData;
 
+namespace utility
+{
+class LatencyHistogram;
+} // namespace utility
+
 class PARAMETER_EXPORT CSubsystem : public CConfigurableElement, private IMapper
 {
     // Subsystem objects iterator
@@ -72,6 +82,40 @@ public:
     // Resynchronization after subsystem restart needed
     virtual bool needResync(bool bClear);
 
+    /** Can the subsystem objects be synchronized concurrently with other subsystems ones
+     *
+     * Objects of a subsystem are never synchronized concurrently with each other.
+     *
+     * @return true if allowed (default), false otherwise
+     */
+    bool isConcurrentSyncAllowed() const;
+
+    /** Count a synchronization of one of the subsystem objects
+     *
+     * @param[in] bPerformed true if the object was synchronized, false if skipped because its
+     *                       blackboard range was not modified since its last synchronization
+     */
+    void countSync(bool bPerformed) const;
+
+    /** @return the synchronization counters, as a human readable string */
+    std::string getSyncStatistics() const;
+
+    /** Record or not the synchronization latency of each subsystem object
+     *
+     * @param[in] bRecorded true to record
+     */
+    void setSyncLatencyRecorded(bool bRecorded);
+
+    /** @return where to record a synchronization latency, nullptr if not recorded */
+    utility::LatencyHistogram *getSyncLatencyRecorder() const;
+
+    /** @return the recorded synchronization latencies */
+    const utility::LatencyHistogram &getSyncLatency() const;
+    void resetSyncLatency();
+
+    /** @return the time taken to map the subsystem elements, when built from XML */
+    std::chrono::microseconds getMappingDuration() const;
+
     // from CElement
     std::string getKind() const override;
 
@@ -96,6 +140,12 @@ public:
     virtual std::string getMapping(
         std::list<const CConfigurableElement *> &configurableElementPath) const;
 
+    /** Lock of the subsystem parameters, when parameter accesses are locked per subsystem
+     *
+     * @return the mutex to hold while accessing the subsystem part of the main blackboard
+     */
+    std::mutex &getAccessMutex() const;
+
 protected:
     // Used for simulation and virtual subsystems
     void setDefaultValues(CParameterAccessContext &parameterAccessContext) const override;
@@ -105,6 +155,14 @@ protected:
     void addContextMappingKey(const std::string &strMappingKey);
     // Subsystem object creator publication (strong reference)
     void addSubsystemObjectFactory(CSubsystemObjectCreator *pSubsystemObjectCreator);
+    /** Allow or prevent concurrent synchronization with other subsystems
+     *
+     * To be called by subsystems whose objects can not be synchronized from another thread,
+     * or while other subsystems are synchronized.
+     *
+     * @param[in] bAllowed false to opt out of concurrent synchronization
+     */
+    void setConcurrentSyncAllowed(bool bAllowed);
 
 private:
     CSubsystem(const CSubsystem &);
@@ -251,4 +309,22 @@ private:
 
     /** Logger which has to be provided to subsystem objects */
     core::log::Logger &_logger;
+
+    /** Can the subsystem objects be synchronized concurrently with other subsystems ones */
+    bool _bConcurrentSyncAllowed{true};
+
+    /** Synchronization counters, incremented concurrently when subsystems are synchronized in
+     * parallel */
+    mutable std::atomic<uint64_t> _uiPerformedSyncs{0};
+    mutable std::atomic<uint64_t> _uiSkippedSyncs{0};
+
+    /** Synchronization latencies, recorded concurrently like the counters */
+    std::unique_ptr<utility::LatencyHistogram> _syncLatency;
+    bool _bSyncLatencyRecorded{false};
+
+    /** Time taken by mapSubsystemElements */
+    std::chrono::microseconds _mappingDuration{0};
+
+    /** Parameter access lock, see getAccessMutex */
+    mutable std::mutex _accessMutex;
 };
@@ -128,6 +128,15 @@ bool CSubsystemObject::sync(CParameterBlackboard &parameterBlackboard, bool bBac
     }
 
     // Synchronize to/from HW
+    // Skip sending to HW what has not been modified since last sent
+    if (bIsSubsystemAlive && !bBack && _bSynced &&
+        !parameterBlackboard.isDirtySince(getOffset(), _dataSize, _uiSyncedGeneration)) {
+
+        pSubsystem->countSync(false);
+        return true;
+    }
+    uint64_t uiGeneration = parameterBlackboard.getGeneration();
+
     if (!bIsSubsystemAlive || !accessHW(bBack, strError)) {
 
         // Fall back to parameter default initialization
@@ -135,8 +144,15 @@ bool CSubsystemObject::sync(CParameterBlackboard &parameterBlackboard, bool bBac
 
             setDefaultValues(parameterBlackboard);
         }
+        // Resend on next synchronization
+        _bSynced = false;
         return false;
     }
+    pSubsystem->countSync(true);
+
+    // What was received is what the HW holds
+    _bSynced = true;
+    _uiSyncedGeneration = bBack ? parameterBlackboard.getGeneration() : uiGeneration;
 
     return true;
 }
@@ -125,4 +125,7 @@ private:
     CParameterBlackboard *_blackboard{nullptr};
     // Accessed index for Subsystem read/write from/to blackboard
     size_t _accessedIndex{0};
+    // Has the object been synchronized once, and blackboard generation it was synchronized with
+    bool _bSynced{false};
+    uint64_t _uiSyncedGeneration{0};
 };
@@ -29,12 +29,14 @@
  */
 #include "SyncerSet.h"
 #include "Syncer.h"
+#include "Subsystem.h"
+#include "ThreadPool.hpp"
+#include "LatencyHistogram.hpp"
+#include <vector>
 
-const CSyncerSet &CSyncerSet::operator+=(ISyncer *pRightSyncer)
+void CSyncerSet::add(ISyncer *pSyncer, const CSubsystem *pSubsystem)
 {
-    _syncerSet.insert(pRightSyncer);
-
-    return *this;
+    _syncerSet.emplace(pSyncer, pSubsystem);
 }
 
 const CSyncerSet &CSyncerSet::operator+=(const CSyncerSet &rightSyncerSet)
@@ -52,28 +54,114 @@ void CSyncerSet::clear()
     _syncerSet.clear();
 }
 
+bool CSyncerSet::empty() const
+{
+    return _syncerSet.empty();
+}
+
 bool CSyncerSet::sync(CParameterBlackboard &parameterBlackboard, bool bBack,
-                      core::Results *errors) const
+                      core::Results *errors, utility::ThreadPool *pThreadPool) const
 {
     bool bSuccess = true;
 
     std::string strError;
 
-    // Propagate
-    SyncerSetConstIterator it;
+    if (pThreadPool == nullptr) {
 
-    for (it = _syncerSet.begin(); it != _syncerSet.end(); ++it) {
+        // Propagate
+        SyncerSetConstIterator it;
 
-        ISyncer *pSyncer = *it;
+        for (it = _syncerSet.begin(); it != _syncerSet.end(); ++it) {
 
-        if (!pSyncer->sync(parameterBlackboard, bBack, strError)) {
+            ISyncer *pSyncer = it->first;
+            const CSubsystem *pSubsystem = it->second;
 
-            if (errors != nullptr) {
+            utility::ScopedLatency latency(
+                pSubsystem != nullptr ? pSubsystem->getSyncLatencyRecorder() : nullptr);
 
-                errors->push_back(strError);
+            if (!pSyncer->sync(parameterBlackboard, bBack, strError)) {
+
+                if (errors != nullptr) {
+
+                    errors->push_back(strError);
+                }
+                bSuccess = false;
             }
-            bSuccess = false;
         }
+        return bSuccess;
+    }
+
+    // Group syncers per subsystem, in order of first appearance
+    struct Group
+    {
+        const CSubsystem *pSubsystem;
+        std::vector<ISyncer *> syncers;
+        core::Results errors;
+        bool bSuccess;
+    };
+    std::vector<Group> groups;
+    std::map<const CSubsystem *, size_t> groupIndexes;
+
+    for (const auto &syncer : _syncerSet) {
+
+        auto result = groupIndexes.emplace(syncer.second, groups.size());
+
+        if (result.second) {
+
+            groups.push_back({syncer.second, {}, {}, true});
+        }
+        groups[result.first->second].syncers.push_back(syncer.first);
+    }
+
+    auto syncGroup = [&](size_t index) {
+        Group &group = groups[index];
+        std::string strGroupError;
+
+        for (ISyncer *pSyncer : group.syncers) {
+
+            utility::ScopedLatency latency(
+                group.pSubsystem != nullptr ? group.pSubsystem->getSyncLatencyRecorder() : nullptr);
+
+            if (!pSyncer->sync(parameterBlackboard, bBack, strGroupError)) {
+
+                group.errors.push_back(strGroupError);
+                group.bSuccess = false;
+            }
+        }
+    };
+
+    // Subsystems not allowing it are synchronized afterwards, from the calling thread
+    std::vector<size_t> concurrentGroups;
+    std::vector<size_t> serialGroups;
+
+    for (size_t index = 0; index < groups.size(); index++) {
+
+        const CSubsystem *pSubsystem = groups[index].pSubsystem;
+
+        if (pSubsystem != nullptr && pSubsystem->isConcurrentSyncAllowed()) {
+
+            concurrentGroups.push_back(index);
+        } else {
+
+            serialGroups.push_back(index);
+        }
+    }
+    pThreadPool->parallelFor(concurrentGroups.size(),
+                             [&](size_t task) { syncGroup(concurrentGroups[task]); });
+
+    for (size_t index : serialGroups) {
+
+        syncGroup(index);
+    }
+
+    // Gather errors in group order
+    for (const Group &group : groups) {
+
+        if (errors != nullptr) {
+
+            errors->insert(errors->end(), group.errors.begin(), group.errors.end());
+        }
+        bSuccess = bSuccess && group.bSuccess;
     }
     return bSuccess;
 }
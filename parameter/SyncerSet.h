@@ -30,32 +30,53 @@
 #pragma once
 
 #include "Results.h"
-#include <set>
+#include <map>
 
 class ISyncer;
 class CParameterBlackboard;
+class CSubsystem;
+
+namespace utility
+{
+class ThreadPool;
+} // namespace utility
 
 class CSyncerSet
 {
-    typedef std::set<ISyncer *>::const_iterator SyncerSetConstIterator;
+    typedef std::map<ISyncer *, const CSubsystem *>::const_iterator SyncerSetConstIterator;
 
 public:
     // Filling
-    const CSyncerSet &operator+=(ISyncer *pRightSyncer);
+    /** Add a syncer
+     *
+     * @param[in] pSyncer the syncer
+     * @param[in] pSubsystem the subsystem owning the syncer
+     */
+    void add(ISyncer *pSyncer, const CSubsystem *pSubsystem);
     const CSyncerSet &operator+=(const CSyncerSet &rightSyncerSet);
 
     // Clearing
     void clear();
 
+    bool empty() const;
+
     /** Sync the blackboard
+     *
+     * Without thread pool, syncers are synchronized one after the other. Otherwise, syncers of
+     * different subsystems are synchronized concurrently, except for the subsystems not allowing
+     * it, which are synchronized afterwards. Syncers of a subsystem are always synchronized one
+     * after the other, in the same order.
      *
      * @param parameterBlackboard blackboard associated to syncer
      * @param[in] bBack indicates if we want to back synchronise or to forward synchronise
      * @param[out] errors, errors encountered during restoration
+     * @param[in] pThreadPool the pool to synchronize subsystems concurrently with, if any
      * @return true if success false otherwise
      */
-    bool sync(CParameterBlackboard &parameterBlackboard, bool bBack, core::Results *errors) const;
+    bool sync(CParameterBlackboard &parameterBlackboard, bool bBack, core::Results *errors,
+              utility::ThreadPool *pThreadPool = nullptr) const;
 
 private:
-    std::set<ISyncer *> _syncerSet;
+    // Syncers and their subsystem
+    std::map<ISyncer *, const CSubsystem *> _syncerSet;
 };
@@ -37,6 +37,7 @@
 #include "DynamicLibrary.hpp"
 #include "Utility.h"
 #include "Memory.hpp"
+#include "ParameterBlackboard.h"
 
 #define base CConfigurableElement
 
@@ -97,6 +98,7 @@ bool CSystemClass::loadSubsystems(string &strError, const CSubsystemPlugins *pSu
 {
     // Start clean
     _pSubsystemLibrary->clean();
+    _pluginLoadTimes.clear();
 
     typedef TLoggingElementBuilderTemplate<CVirtualSubsystem> VirtualSubsystemBuilder;
     // Add virtual subsystem builder
@@ -187,6 +189,12 @@ bool CSystemClass::loadPlugins(list<string> &lstrPluginFiles, core::Results &err
     while (it != lstrPluginFiles.end()) {
 
         string strPluginFileName = *it;
+        auto loadStart = std::chrono::steady_clock::now();
+        auto recordLoadTime = [&] {
+            _pluginLoadTimes.push_back(
+                {strPluginFileName, std::chrono::duration_cast<std::chrono::microseconds>(
+                                        std::chrono::steady_clock::now() - loadStart)});
+        };
 
         // Load attempt
         try {
@@ -203,6 +211,7 @@ bool CSystemClass::loadPlugins(list<string> &lstrPluginFiles, core::Results &err
 
         } catch (std::exception &e) {
             errors.push_back(e.what());
+            recordLoadTime();
 
             // Next plugin
             ++it;
@@ -210,6 +219,8 @@ bool CSystemClass::loadPlugins(list<string> &lstrPluginFiles, core::Results &err
             continue;
         }
 
+        recordLoadTime();
+
         // Account for this success
         bAtLeastOneSubsystemPluginSuccessfullyLoaded = true;
 
@@ -225,7 +236,13 @@ const CSubsystemLibrary *CSystemClass::getSubsystemLibrary() const
     return _pSubsystemLibrary;
 }
 
-void CSystemClass::checkForSubsystemsToResync(CSyncerSet &syncerSet, core::Results &infos)
+const std::vector<CSystemClass::PluginLoadTime> &CSystemClass::getPluginLoadTimes() const
+{
+    return _pluginLoadTimes;
+}
+
+void CSystemClass::checkForSubsystemsToResync(CParameterBlackboard *pParameterBlackboard,
+                                              CSyncerSet &syncerSet, core::Results &infos)
 {
     size_t uiNbChildren = getNbChildren();
     size_t uiChild;
@@ -240,6 +257,8 @@ void CSystemClass::checkForSubsystemsToResync(CSyncerSet &syncerSet, core::Resul
             infos.push_back("Resynchronizing subsystem: " + pSubsystem->getName());
             // get all subsystem syncers
             pSubsystem->fillSyncerSet(syncerSet);
+            // and have them all resent, even if unmodified
+            pParameterBlackboard->markDirty(pSubsystem->getOffset(), pSubsystem->getFootPrint());
         }
     }
 }
@@ -257,3 +276,16 @@ void CSystemClass::cleanSubsystemsNeedToResync()
         pSubsystem->needResync(true);
     }
 }
+
+void CSystemClass::listSyncStatistics(string &strResult) const
+{
+    size_t uiNbChildren = getNbChildren();
+    size_t uiChild;
+
+    for (uiChild = 0; uiChild < uiNbChildren; uiChild++) {
+
+        const CSubsystem *pSubsystem = static_cast<const CSubsystem *>(getChild(uiChild));
+
+        strResult += pSubsystem->getName() + ": " + pSubsystem->getSyncStatistics() + "\n";
+    }
+}
@@ -33,12 +33,15 @@
 #include "SubsystemPlugins.h"
 #include "Results.h"
 #include <log/Logger.h>
+#include <chrono>
 #include <list>
 #include <string>
 #include <memory>
+#include <vector>
 
 class CSubsystemLibrary;
 class DynamicLibrary;
+class CParameterBlackboard;
 
 class CSystemClass final : public CConfigurableElement
 {
@@ -65,21 +68,40 @@ public:
     // Subsystem factory
     const CSubsystemLibrary *getSubsystemLibrary() const;
 
+    /** Time taken to load a plugin library and run its subsystem builder */
+    struct PluginLoadTime
+    {
+        std::string plugin;
+        std::chrono::microseconds duration;
+    };
+    /** @return the load attempts of the last loadSubsystems call, in attempt order */
+    const std::vector<PluginLoadTime> &getPluginLoadTimes() const;
+
     /**
       * Look for subsystems that need to be resynchronized.
       * Consume the need to be resynchronized
       * and fill a syncer set with all syncers that need to be resynchronized
       *
+      * @param[in] pParameterBlackboard The blackboard where the resynchronized subsystems ranges
+      *                                 are marked modified, so that all their syncers are resent
       * @param[out] syncerSet The syncer set to fill
       * @param[out] infos Relevant informations client may want to log
       */
-    void checkForSubsystemsToResync(CSyncerSet &syncerSet, core::Results &infos);
+    void checkForSubsystemsToResync(CParameterBlackboard *pParameterBlackboard,
+                                    CSyncerSet &syncerSet, core::Results &infos);
 
     /**
       * Reset subsystems need to resync flag.
       */
     void cleanSubsystemsNeedToResync();
 
+    /**
+      * List the synchronization counters of each subsystem.
+      *
+      * @param[out] strResult One line per subsystem
+      */
+    void listSyncStatistics(std::string &strResult) const;
+
     // base
     std::string getKind() const override;
 
@@ -119,6 +141,9 @@ private:
     std::list<std::unique_ptr<DynamicLibrary>>
         _subsystemLibraryHandleList; /**< Contains the list of all open plugin libs. */
 
+    /** Load attempts of the plugins */
+    std::vector<PluginLoadTime> _pluginLoadTimes;
+
     /** Application Logger we need to provide to plugins */
     core::log::Logger &_logger;
 
@@ -56,7 +56,7 @@ ISyncer *CVirtualSubsystem::getSyncer() const
 
 void CVirtualSubsystem::fillSyncerSetFromDescendant(CSyncerSet &syncerSet) const
 {
-    syncerSet += _pVirtualSyncer;
+    syncerSet.add(_pVirtualSyncer, this);
 }
 
 // From IMapper
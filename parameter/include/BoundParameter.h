@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "parameter_export.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/** Forward declaration of private classes.
+ * They are not part of the public api and may be remove/renamed in any release.
+ * @{
+ */
+class CParameterMgr;
+class CParameter;
+/** @} */
+class ElementHandle;
+
+/** Conversions between the user values of a scalar parameter and its blackboard encoding
+ *
+ * Filled once by the parameter type from its attributes and adaptation, so that bound
+ * parameters convert values without going through the type.
+ * Not part of the public api and may be modified in any release.
+ */
+struct ScalarCodec
+{
+    enum class Kind
+    {
+        Unsupported,
+        Boolean,
+        Integer,
+        FixedPoint,
+        FloatingPoint
+    };
+    enum class Adaptation
+    {
+        None,
+        Offset,
+        Linear,
+        Logarithmic
+    };
+
+    Kind kind{Kind::Unsupported};
+    /** Size of the encoded value, in bytes */
+    size_t size{0};
+
+    /** Integer: signedness and range of the encoded value */
+    bool isSigned{false};
+    int64_t min{0};
+    int64_t max{0};
+
+    /** Integer: conversion of double user values */
+    Adaptation adaptation{Adaptation::None};
+    int32_t offset{0};
+    double slopeNumerator{1};
+    double slopeDenominator{1};
+    double logarithmBase{10};
+    double floorValue{0};
+
+    /** Fixed and floating points: range of the user value */
+    double doubleMin{0};
+    double doubleMax{0};
+
+    /** Fixed point: number of fractional bits and left justification of the encoded value */
+    uint32_t fractional{0};
+    uint32_t justification{0};
+};
+
+/** Precompiled accessor of a scalar parameter, see ElementHandle::bind
+ *
+ * The parameter location and the conversions of its type are resolved when bound, so that
+ * accesses only check the value range, without error message nor type dispatch. Accesses are
+ * otherwise done as ElementHandle ones: reads use the last published parameter values, writes
+ * are only allowed to rogue parameters, are synchronized and skipped in tuning mode.
+ *
+ * Supported types are bool for boolean parameters, uint32_t for boolean and integer
+ * parameters, int32_t for integer parameters and double for fixed point, floating point and
+ * adapted integer parameters.
+ *
+ * Instances must not outlive the connector they were bound from.
+ */
+template <class T>
+class PARAMETER_EXPORT BoundParameter
+{
+public:
+    /** Create an unbound accessor, whose accesses fail */
+    BoundParameter() = default;
+
+    /** @return true if bound to a parameter */
+    bool isBound() const;
+
+    /** Read the parameter value
+     *
+     * @param[out] value the parameter value, unmodified on failure
+     * @return true on success, false if unbound
+     */
+    bool get(T &value) const;
+
+    /** Write the parameter value
+     *
+     * @param[in] value the value to write
+     * @return true on success (or in tuning mode, where writes are ignored), false if unbound,
+     *         if the value is out of range, if the parameter is not rogue or if its
+     *         synchronization failed.
+     */
+    bool set(T value);
+
+private:
+    friend class ElementHandle;
+
+    BoundParameter(const CParameter &parameter, CParameterMgr &parameterMgr,
+                   const ScalarCodec &codec);
+
+    /** @return true if values of type T can be converted by the codec */
+    static bool isSupported(const ScalarCodec &codec);
+
+    /** Convert a user value to its blackboard encoding
+     * @return false if out of range */
+    bool encode(T value, uint32_t &data) const;
+
+    /** Convert a blackboard encoding to its user value */
+    T decode(uint32_t data) const;
+
+    const CParameter *mParameter{nullptr};
+    CParameterMgr *mParameterMgr{nullptr};
+    /** Offset of the parameter in the main blackboard */
+    size_t mOffset{0};
+    ScalarCodec mCodec;
+};
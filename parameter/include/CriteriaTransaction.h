@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "SelectionCriterionInterface.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+/** Criterion states staged to be published and applied all at once
+ *
+ * @see CParameterMgrPlatformConnector::applyCriteriaTransaction
+ */
+class CriteriaTransaction
+{
+public:
+    /** A criterion and its staged state */
+    using CriterionState = std::pair<ISelectionCriterionInterface *, int>;
+
+    /** Stage the state of a criterion, replacing the one already staged if any
+     *
+     * @param[in] criterion the criterion, as returned by the connector
+     * @param[in] state the new state of the criterion
+     */
+    void setCriterionState(ISelectionCriterionInterface *criterion, int state)
+    {
+        auto staged = std::find_if(begin(mStates), end(mStates),
+                                   [&](const CriterionState &s) { return s.first == criterion; });
+
+        if (staged != end(mStates)) {
+            staged->second = state;
+        } else {
+            mStates.emplace_back(criterion, state);
+        }
+    }
+
+    /** @return the staged state of a criterion, or nullptr if not staged */
+    const int *getCriterionState(const ISelectionCriterionInterface *criterion) const
+    {
+        auto staged = std::find_if(begin(mStates), end(mStates),
+                                   [&](const CriterionState &s) { return s.first == criterion; });
+
+        return staged != end(mStates) ? &staged->second : nullptr;
+    }
+
+    /** @return the staged criterion states, in staging order */
+    const std::vector<CriterionState> &getStates() const { return mStates; }
+
+private:
+    std::vector<CriterionState> mStates;
+};
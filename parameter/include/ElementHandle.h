@@ -30,6 +30,8 @@
 #pragma once
 
 #include "parameter_export.h"
+#include "BoundParameter.h"
+#include "ParameterArrayView.h"
 
 #include <stdint.h>
 #include <string>
@@ -43,6 +45,7 @@
 class CParameterMgr;
 class CConfigurableElement;
 class CBaseParameter;
+class CParameter;
 /** @} */
 
 /** TODO */
@@ -224,9 +227,42 @@ public:
 
     /** @} */
 
+    /** Precompile an accessor of a scalar parameter
+     *
+     * Intended for parameters accessed at high rates, see BoundParameter.
+     *
+     * @tparam T the user value type: bool, uint32_t, int32_t or double
+     * @param[out] error On failure (unbound accessor returned): a human readable error message
+     *                   On success: unspecified
+     * @return the accessor, unbound if the element is not a scalar parameter accessible as T
+     */
+    template <class T>
+    BoundParameter<T> bind(std::string &error) const;
+
+    /** View the content of an array parameter, without copy
+     *
+     * Intended for large arrays, see ParameterArrayView.
+     *
+     * @param[out] error On failure (invalid view returned): a human readable error message
+     *                   On success: unspecified
+     * @return the view, invalid if the element is not an array of scalar parameters
+     */
+    ParameterArrayView getArrayView(std::string &error) const;
+
+    /** View the content of a rogue integer array parameter, for writing without copy
+     *
+     * Fails in tuning mode, as writes would be ignored. See WritableParameterArrayView.
+     *
+     * @param[out] error On failure (invalid view returned): a human readable error message
+     *                   On success: unspecified
+     * @return the view, invalid if the element is not a rogue integer array parameter
+     */
+    WritableParameterArrayView getWritableArrayView(std::string &error);
+
 protected:
     ElementHandle(CConfigurableElement &element, CParameterMgr &parameterMgr);
     friend CParameterMgr; // So that it can build the handler
+    friend class ParameterTransaction; // So that it can queue writes
 
 private:
     template <class T>
@@ -258,6 +294,17 @@ private:
      */
     bool checkGetValidity(bool asArray, std::string &error) const;
 
+    /** Get the encoding of a parameter made of whole integer encodings
+     *
+     * @param asArray[in] true if accessing as an array, false otherwise.
+     * @param codec[out] the parameter encoding
+     * @param error[out] If not a parameter or not encoded as whole integers: a human readable
+     *                   message explaining why. Otherwise, not modified.
+     *
+     * @return the parameter on success, nullptr otherwise.
+     */
+    const CParameter *getScalarCodec(bool asArray, ScalarCodec &codec, std::string &error) const;
+
     /** Reference to the handled Configurable element. */
     CConfigurableElement &mElement;
 
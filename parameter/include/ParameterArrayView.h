@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "parameter_export.h"
+#include "BoundParameter.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+/** Forward declaration of private classes.
+ * They are not part of the public api and may be remove/renamed in any release.
+ * @{
+ */
+class CParameterMgr;
+class CParameter;
+/** @} */
+class ElementHandle;
+
+/** Read only view of the content of an array parameter, see ElementHandle::getArrayView
+ *
+ * Gives access to the blackboard encoding of the array elements without copy: getLength()
+ * elements of getStride() bytes, the first one at getData(). Encodings are little endian, as
+ * the blackboard content.
+ *
+ * Outside of tuning mode, the view is on the last published parameter values, without
+ * blocking writers. Otherwise, the blackboard is locked while the view exists, so views must
+ * be short lived and must not be created while already holding one.
+ */
+class PARAMETER_EXPORT ParameterArrayView
+{
+public:
+    /** Create an invalid view, without data */
+    ParameterArrayView();
+    ParameterArrayView(ParameterArrayView &&other);
+    ParameterArrayView &operator=(ParameterArrayView &&other);
+    virtual ~ParameterArrayView();
+
+    /** @return true if the view is on an array parameter */
+    bool isValid() const;
+
+    /** @return the encoding of the first element, nullptr if invalid */
+    const void *getData() const;
+
+    /** @return the number of elements, 0 if invalid */
+    size_t getLength() const;
+
+    /** @return the number of bytes from an element to the next one, 0 if invalid */
+    size_t getStride() const;
+
+    /** Convert all elements at once
+     *
+     * Conversions are the ones of ElementHandle::getAs*Array, in the real value space.
+     * Supported element types are the BoundParameter ones.
+     *
+     * @param[out] values getLength() values, unmodified on failure
+     * @return true on success, false if invalid or if the conversion is not supported
+     * @{
+     */
+    bool getAsIntegers(uint32_t values[]) const;
+    bool getAsSignedIntegers(int32_t values[]) const;
+    bool getAsDoubles(double values[]) const;
+    /** @} */
+
+protected:
+    /** Keeps the viewed blackboard valid (and locked if needed) while the view exists */
+    struct Guard;
+
+    /**
+     * @param[in] parameterMgr the parameter manager owning the blackboard
+     * @param[in] parameter the viewed array parameter
+     * @param[in] codec the encoding of the parameter elements
+     * @param[in] bWritable true to view the main blackboard under lock
+     */
+    ParameterArrayView(CParameterMgr &parameterMgr, const CParameter &parameter,
+                       const ScalarCodec &codec, bool bWritable);
+
+    std::unique_ptr<Guard> mGuard;
+    const uint8_t *mData{nullptr};
+    size_t mLength{0};
+    ScalarCodec mCodec;
+
+private:
+    friend class ElementHandle;
+};
+
+/** Writable view of the content of a rogue integer array parameter,
+ * see ElementHandle::getWritableArrayView
+ *
+ * The blackboard is locked while the view exists. Raw encodings are written directly, without
+ * range check: writers are responsible for the validity of the values they write.
+ * The written values are synchronized and published by commit, or on destruction.
+ */
+class PARAMETER_EXPORT WritableParameterArrayView : public ParameterArrayView
+{
+public:
+    WritableParameterArrayView() = default;
+    WritableParameterArrayView(WritableParameterArrayView &&other) = default;
+    WritableParameterArrayView &operator=(WritableParameterArrayView &&other);
+    ~WritableParameterArrayView() override;
+
+    /** @return the encoding of the first element, nullptr if invalid or committed */
+    void *getData();
+
+    /** Synchronize and publish the written values, then release the blackboard
+     *
+     * The view is invalid afterward.
+     *
+     * @param[out] error On failure: a human readable description of the error
+     *                   On success: unspecified
+     * @return true on success, false if invalid or if the synchronization failed
+     */
+    bool commit(std::string &error);
+
+private:
+    friend class ElementHandle;
+
+    WritableParameterArrayView(CParameterMgr &parameterMgr, const CParameter &parameter,
+                               const ScalarCodec &codec);
+};
@@ -229,6 +229,19 @@ public:
     bool exportDomainsXml(std::string &strXmlDest, bool bWithSettings, bool bToFile,
                           std::string &strError) const;
 
+    /** Compile the Configurable Domains, with their settings, to a binary bundle
+     *
+     * The bundle can be loaded at start instead of the XML settings file, see the
+     * ConfigurableDomainsBundleFileLocation framework configuration element. It is only valid
+     * for the structure it has been compiled for.
+     *
+     * @param[in] bundlePath the path of the bundle file to write
+     * @param[out] strError is used as the error output
+     *
+     * @return false if any error occurs, true otherwise.
+     */
+    bool exportDomainsBundle(const std::string &bundlePath, std::string &strError);
+
     /**
       * Method that exports a given Configurable Domain to an Xml destination.
       *
@@ -35,6 +35,10 @@
 #include "SelectionCriterionInterface.h"
 #include "ParameterHandle.h"
 #include "ElementHandle.h"
+#include "ApplyReport.h"
+#include "CriteriaTransaction.h"
+#include "ParameterTransaction.h"
+#include "ApplyStatistics.h"
 #include "ParameterMgrLoggerForward.h"
 
 class CParameterMgr;
@@ -88,6 +92,55 @@ public:
     // Configuration application
     void applyConfigurations();
 
+    /** Apply configurations from a dedicated thread.
+      *
+      * Returns without waiting for the application. Requests made while an application is in
+      * progress are coalesced into a single application following it.
+      *
+      * @param[in] callback called from the apply thread once an application started after the
+      *                     request is done, with the domains whose configuration was applied and
+      *                     the sync errors. May be empty.
+      * @return false if not started, the request being dropped, true otherwise
+      */
+    bool applyConfigurationsAsync(ApplyCallback callback = nullptr);
+
+    /** Publish staged criterion states and apply configurations, all at once.
+      *
+      * Unlike setting the criteria one by one before applying, no application can happen while
+      * the states are published, and rules are evaluated and hardware synchronized only once.
+      *
+      * @param[in] transaction the staged criterion states
+      * @return false if not started, nothing being published, true otherwise
+      */
+    bool applyCriteriaTransaction(const CriteriaTransaction &transaction);
+
+    /** Record or not the latencies of applications, of each domain application and of each
+      * subsystem object synchronization.
+      *
+      * Off by default. Recording costs two clock reads per timed operation.
+      *
+      * @param[in] bEnabled true to record
+      */
+    void setApplyStatisticsEnabled(bool bEnabled);
+    bool isApplyStatisticsEnabled() const;
+
+    /** @return the latencies recorded so far, per domain and per subsystem */
+    ApplyStatistics getApplyStatistics() const;
+
+    /** Forget the latencies recorded so far */
+    void resetApplyStatistics();
+
+    /** Durations of the start phases, in microseconds, and their heap growth, in bytes
+      *
+      * Phases break their duration down per plugin, file or subsystem when relevant. Heap growth
+      * is null where the allocator does not report heap usage.
+      *
+      * @return the profile of the last start, in JSON:
+      *         {"total": us, "phases": [{"name": "...", "duration": us, "heapGrowth": bytes,
+      *          "breakdowns": {"<breakdown>": [{"name": "...", "duration": us}, ...]}}, ...]}
+      */
+    std::string getStartupProfile() const;
+
     // Dynamic parameter handling
     // Returned objects are owned by clients
     // Must be cassed after successfull start
@@ -107,6 +160,14 @@ public:
      */
     ElementHandle *createElementHandle(const std::string &path, std::string &error) const;
 
+    /** Creates a transaction to write several parameters at once, synchronizing them once.
+     *
+     * The returned object is owned by the client who is responsible to delete it.
+     *
+     * @return An empty parameter transaction
+     */
+    ParameterTransaction *createParameterTransaction() const;
+
     /** Is the remote interface forcefully disabled ?
      */
     bool getForceNoRemoteInterface() const;
@@ -157,6 +218,83 @@ public:
       */
     bool getFailureOnFailedSettingsLoad() const;
 
+    /** Number of threads applying domains concurrently.
+      *
+      * Will fail if called on started instance.
+      * Only domains sharing no parameter with other domains are applied concurrently.
+      *
+      * @param[in] threadCount 0 to rely on the ApplyThreadCount attribute of the framework
+      *                        configuration file, 1 to apply domains serially.
+      * @param[out] strError On error: an human readable error message
+      *                      On success: undefined
+      *
+      * @return false if unable to set, true otherwise.
+      */
+    bool setApplyThreadCount(size_t threadCount, std::string &strError);
+    /** Number of threads applying domains concurrently.
+      *
+      * @return the requested count, 0 if relying on the framework configuration file.
+      */
+    size_t getApplyThreadCount() const;
+
+    /** Number of threads synchronizing subsystems concurrently.
+      *
+      * Will fail if called on started instance.
+      * Subsystems may opt out, their objects are then synchronized after the others.
+      *
+      * @param[in] threadCount 0 to rely on the SyncThreadCount attribute of the framework
+      *                        configuration file, 1 to synchronize subsystems serially.
+      * @param[out] strError On error: an human readable error message
+      *                      On success: undefined
+      *
+      * @return false if unable to set, true otherwise.
+      */
+    bool setSyncThreadCount(size_t threadCount, std::string &strError);
+    /** Number of threads synchronizing subsystems concurrently.
+      *
+      * @return the requested count, 0 if relying on the framework configuration file.
+      */
+    size_t getSyncThreadCount() const;
+
+    /** Number of threads parsing structure and settings files concurrently on start.
+      *
+      * Will fail if called on started instance.
+      *
+      * @param[in] threadCount 0 to rely on the LoadThreadCount attribute of the framework
+      *                        configuration file, 1 to parse files serially.
+      * @param[out] strError On error: an human readable error message
+      *                      On success: undefined
+      *
+      * @return false if unable to set, true otherwise.
+      */
+    bool setLoadThreadCount(size_t threadCount, std::string &strError);
+    /** Number of threads parsing structure and settings files concurrently on start.
+      *
+      * @return the requested count, 0 if relying on the framework configuration file.
+      */
+    size_t getLoadThreadCount() const;
+
+    /** Lock parameter accesses per subsystem.
+      *
+      * Will fail if called on started instance.
+      * When enabled, parameter accesses only lock the subsystem holding the parameter, so that
+      * accesses to different subsystems do not wait for each other. Configuration application
+      * and tuning still lock all subsystems. Reads then no longer rely on published snapshots
+      * of the parameter values.
+      *
+      * @param[in] bEnabled true to lock per subsystem, false to lock all parameters at once.
+      * @param[out] strError On error: an human readable error message
+      *                      On success: undefined
+      *
+      * @return false if unable to set, true otherwise.
+      */
+    bool setLockSharding(bool bEnabled, std::string &strError);
+    /** Are parameter accesses locked per subsystem.
+      *
+      * @return true if enabled, false otherwise.
+      */
+    bool isLockShardingEnabled() const;
+
     /** Get the XML Schemas URI
      *
      * @returns the XML Schemas URI
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "parameter_export.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/** Forward declaration of private classes.
+ * They are not part of the public api and may be remove/renamed in any release.
+ * @{
+ */
+class CParameterMgr;
+class CConfigurableElement;
+class CParameterAccessContext;
+/** @} */
+class ElementHandle;
+
+/** Parameter writes queued to be done all at once
+ *
+ * Writes are checked when queued as ElementHandle setters do, then done on commit under a
+ * single lock of the parameters. The written parameters are synchronized afterwards, each
+ * syncer once however many of its parameters were written.
+ *
+ * Instances are created by CParameterMgrPlatformConnector::createParameterTransaction and must
+ * outlive neither their connector nor the handles they are given.
+ */
+class PARAMETER_EXPORT ParameterTransaction
+{
+public:
+    /** Queue a write of a parameter, see the ElementHandle setter of the same name
+     *
+     * @param[in] handle the parameter to write
+     * @param[in] value the value to write
+     * @param[out] error On error: an human readable error message
+     *                   On success: undefined
+     *
+     * @return true if queued, false if the parameter can not be written, in which case the
+     *         transaction is left unmodified.
+     * @{
+     */
+    bool setAsBoolean(const ElementHandle &handle, bool value, std::string &error);
+    bool setAsBooleanArray(const ElementHandle &handle, const std::vector<bool> &value,
+                           std::string &error);
+    bool setAsInteger(const ElementHandle &handle, uint32_t value, std::string &error);
+    bool setAsIntegerArray(const ElementHandle &handle, const std::vector<uint32_t> &value,
+                           std::string &error);
+    bool setAsSignedInteger(const ElementHandle &handle, int32_t value, std::string &error);
+    bool setAsSignedIntegerArray(const ElementHandle &handle, const std::vector<int32_t> &value,
+                                 std::string &error);
+    bool setAsDouble(const ElementHandle &handle, double value, std::string &error);
+    bool setAsDoubleArray(const ElementHandle &handle, const std::vector<double> &value,
+                          std::string &error);
+    bool setAsString(const ElementHandle &handle, const std::string &value, std::string &error);
+    bool setAsStringArray(const ElementHandle &handle, const std::vector<std::string> &value,
+                          std::string &error);
+    /** @} */
+
+    /** Queue a write of a parameter given by its path, as a string
+     *
+     * @param[in] path the parameter path
+     * @param[in] value the value to write, in the format of ElementHandle::setAsString
+     * @param[out] error On error: an human readable error message
+     *                   On success: undefined
+     *
+     * @return true if queued, false otherwise.
+     */
+    bool setValue(const std::string &path, const std::string &value, std::string &error);
+
+    /** @return the number of queued writes */
+    size_t getWriteCount() const;
+
+    /** Drop the queued writes */
+    void clear();
+
+    /** Do the queued writes then synchronize the written parameters
+     *
+     * All writes are done or none: if one fails, e.g. because of an out of range value, the
+     * parameters written before it are restored and nothing is synchronized.
+     * As ElementHandle setters, writes are silently dropped in tuning mode.
+     * The transaction is empty afterwards, whatever the result.
+     *
+     * @param[out] error On error: an human readable error message
+     *                   On success: undefined
+     *
+     * @return true on success, false if a write or the synchronization failed.
+     */
+    bool commit(std::string &error);
+
+    ~ParameterTransaction();
+
+private:
+    ParameterTransaction(CParameterMgr &parameterMgr);
+    friend CParameterMgr; // So that it can build the transaction
+
+    ParameterTransaction(const ParameterTransaction &) = delete;
+    ParameterTransaction &operator=(const ParameterTransaction &) = delete;
+
+    template <class T>
+    bool queue(const ElementHandle &handle, const T &value, std::string &error);
+
+    /** A queued write */
+    struct Write
+    {
+        /** The written parameter */
+        CConfigurableElement *element;
+        /** Size of the blackboard range the write may change, from the parameter offset */
+        size_t size;
+        /** Write the queued value with the given context */
+        std::function<bool(CParameterAccessContext &)> write;
+    };
+
+    CParameterMgr &mParameterMgr;
+    std::vector<Write> mWrites;
+    /** Handles of the parameters written by path */
+    std::vector<std::unique_ptr<ElementHandle>> mPathHandles;
+};
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** Compare child lookup by name (CElement::findChild) with a linear scan of the children, as
+ * done before children were indexed, over synthetic trees.
+ *
+ * Wide trees are a root with a growing number of children, looked up in random order. Deep
+ * trees are combs: every level has width children, one of which has the next level below it,
+ * and paths down to the last level are resolved one level at a time.
+ */
+
+#include "Element.h"
+#include "PathNavigator.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using std::string;
+
+namespace
+{
+
+/** Lookups on wide trees, scaled down with the width to bound the linear scan duration */
+const size_t wideLookupBudget = 4000000;
+const size_t deepDepth = 16;
+const size_t deepWidth = 256;
+const size_t deepLookupCount = 100000;
+
+class CNode : public CElement
+{
+public:
+    CNode(const string &strName) : CElement(strName) {}
+
+    string getKind() const override { return "Node"; }
+};
+
+/** Child lookup as done before indexing: compare the path name of every child */
+const CElement *findChildLinearly(const CElement &parent, const string &strName)
+{
+    for (size_t child = 0; child < parent.getNbChildren(); child++) {
+
+        if (parent.getChild(child)->getPathName() == strName) {
+
+            return parent.getChild(child);
+        }
+    }
+    return nullptr;
+}
+
+template <class Lookup>
+double measure(Lookup lookup)
+{
+    auto start = std::chrono::steady_clock::now();
+    lookup();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+string childName(size_t index)
+{
+    return "child" + std::to_string(index);
+}
+
+} // namespace
+
+int main()
+{
+    std::mt19937 random(42);
+
+    std::cout << "Wide trees" << std::endl;
+
+    for (size_t width : {4, 16, 64, 256, 1024, 4096}) {
+
+        size_t lookupCount = wideLookupBudget / width;
+        CNode root("root");
+
+        for (size_t index = 0; index < width; index++) {
+
+            root.addChild(new CNode(childName(index)));
+        }
+        std::vector<string> names;
+        std::uniform_int_distribution<size_t> pick(0, width - 1);
+
+        for (size_t lookup = 0; lookup < lookupCount; lookup++) {
+
+            names.push_back(childName(pick(random)));
+        }
+        size_t found = 0;
+        double linearTime = measure([&] {
+            for (const auto &name : names) {
+                found += findChildLinearly(root, name) != nullptr;
+            }
+        });
+        double indexedTime = measure([&] {
+            for (const auto &name : names) {
+                found += root.findChild(name) != nullptr;
+            }
+        });
+        if (found != 2 * lookupCount) {
+
+            std::cerr << "Children not found" << std::endl;
+            return EXIT_FAILURE;
+        }
+        double lookups = static_cast<double>(lookupCount);
+
+        std::cout << "  " << width << " children, " << lookupCount
+                  << " lookups: linear " << lookups / linearTime << " lookups/s, findChild "
+                  << lookups / indexedTime << " lookups/s, speedup " << linearTime / indexedTime
+                  << std::endl;
+    }
+
+    // Comb of deepDepth levels, the last child of each level bearing the next one
+    CNode root("root");
+    CElement *pLevel = &root;
+    string strPath = "/root";
+
+    for (size_t depth = 0; depth < deepDepth; depth++) {
+
+        CElement *pLast = nullptr;
+
+        for (size_t index = 0; index < deepWidth; index++) {
+
+            pLast = new CNode(childName(index));
+            pLevel->addChild(pLast);
+        }
+        strPath += "/" + childName(deepWidth - 1);
+        pLevel = pLast;
+    }
+    const CElement *pLeaf = pLevel;
+    size_t resolved = 0;
+
+    double linearTime = measure([&] {
+        for (size_t lookup = 0; lookup < deepLookupCount; lookup++) {
+            CPathNavigator pathNavigator(strPath);
+            pathNavigator.next();
+            const CElement *pElement = &root;
+            for (string *pName = pathNavigator.next(); pElement && pName;
+                 pName = pathNavigator.next()) {
+                pElement = findChildLinearly(*pElement, *pName);
+            }
+            resolved += pElement == pLeaf;
+        }
+    });
+    double indexedTime = measure([&] {
+        for (size_t lookup = 0; lookup < deepLookupCount; lookup++) {
+            CPathNavigator pathNavigator(strPath);
+            pathNavigator.next();
+            resolved += root.findDescendant(pathNavigator) == pLeaf;
+        }
+    });
+    if (resolved != 2 * deepLookupCount) {
+
+        std::cerr << "Paths not resolved" << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::cout << "Deep tree, " << deepDepth << " levels of " << deepWidth << " children, "
+              << deepLookupCount << " path resolutions" << std::endl;
+    std::cout << "  linear " << deepLookupCount / linearTime << " paths/s, findDescendant "
+              << deepLookupCount / indexedTime << " paths/s, speedup " << linearTime / indexedTime
+              << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** Measure the throughput of parameter accesses contending with configuration applications,
+ * with and without lock sharding.
+ *
+ * Each of threadCount threads reads and writes a rogue parameter of its own subsystem through an
+ * element handle while another thread keeps switching a domain spanning all subsystems and
+ * applying configurations.
+ */
+
+#include "TmpFile.hpp"
+
+#include <ParameterMgrPlatformConnector.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using std::string;
+
+namespace
+{
+
+const size_t threadCount = 4;
+const std::chrono::seconds duration(2);
+
+class NullLogger : public CParameterMgrPlatformConnector::ILogger
+{
+public:
+    void info(const string &) override {}
+    void warning(const string &) override {}
+};
+
+string subsystemName(size_t index)
+{
+    return "subsystem" + std::to_string(index);
+}
+
+string structure()
+{
+    string subsystems;
+
+    for (size_t index = 0; index < threadCount; index++) {
+
+        subsystems += "<Subsystem Name='" + subsystemName(index) +
+                      "' Type='Virtual'><ComponentLibrary/><InstanceDefinition>"
+                      "<IntegerParameter Name='accessed' Size='32'/>"
+                      "<IntegerParameter Name='applied' Size='32'/>"
+                      "</InstanceDefinition></Subsystem>";
+    }
+    return "<?xml version='1.0' encoding='UTF-8'?><SystemClass Name='bench'>" + subsystems +
+           "</SystemClass>";
+}
+
+string domains()
+{
+    string elements;
+    string settings[2];
+
+    for (size_t index = 0; index < threadCount; index++) {
+
+        string path = "/bench/" + subsystemName(index) + "/applied";
+        elements += "<ConfigurableElement Path='" + path + "'/>";
+
+        for (int state = 0; state < 2; state++) {
+
+            settings[state] += "<ConfigurableElement Path='" + path +
+                               "'><IntegerParameter Name='applied'>" + std::to_string(state) +
+                               "</IntegerParameter></ConfigurableElement>";
+        }
+    }
+    auto configuration = [](const string &state) {
+        return "<Configuration Name='" + state +
+               "'><CompoundRule Type='All'><SelectionCriterionRule SelectionCriterion='State' "
+               "MatchesWhen='Is' Value='" +
+               state + "'/></CompoundRule></Configuration>";
+    };
+    return "<?xml version='1.0' encoding='UTF-8'?><ConfigurableDomains SystemClassName='bench'>"
+           "<ConfigurableDomain Name='Applied'><Configurations>" +
+           configuration("off") + configuration("on") +
+           "</Configurations><ConfigurableElements>" + elements +
+           "</ConfigurableElements><Settings><Configuration Name='off'>" + settings[0] +
+           "</Configuration><Configuration Name='on'>" + settings[1] +
+           "</Configuration></Settings></ConfigurableDomain></ConfigurableDomains>";
+}
+
+/** Run the benchmark, return the parameter access and application throughputs */
+std::pair<double, double> run(const string &configurationPath, bool bLockSharding)
+{
+    NullLogger logger;
+    CParameterMgrPlatformConnector connector(configurationPath);
+    string error;
+
+    connector.setLogger(&logger);
+    connector.setForceNoRemoteInterface(true);
+
+    auto *type = connector.createSelectionCriterionType(false);
+    type->addValuePair(0, "off", error);
+    type->addValuePair(1, "on", error);
+    auto *criterion = connector.createSelectionCriterion("State", type);
+
+    if (!connector.setLockSharding(bLockSharding, error) || !connector.start(error)) {
+
+        std::cerr << "Unable to start: " << error << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> accessCount{0};
+    uint64_t applyCount = 0;
+    std::vector<std::thread> accessors;
+
+    for (size_t index = 0; index < threadCount; index++) {
+
+        std::unique_ptr<ElementHandle> handle(
+            connector.createElementHandle("/bench/" + subsystemName(index) + "/accessed", error));
+        if (handle == nullptr) {
+
+            std::cerr << "Unable to create handle: " << error << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        accessors.emplace_back([&stop, &accessCount](std::unique_ptr<ElementHandle> handle) {
+            string accessError;
+            uint64_t count = 0;
+            for (uint32_t value = 0; not stop; value++, count++) {
+                uint32_t read;
+                handle->setAsInteger(value, accessError);
+                handle->getAsInteger(read, accessError);
+            }
+            accessCount += count;
+        }, std::move(handle));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    while (std::chrono::steady_clock::now() - start < duration) {
+
+        criterion->setCriterionState(static_cast<int>(applyCount % 2));
+        connector.applyConfigurations();
+        applyCount++;
+    }
+    stop = true;
+
+    for (auto &accessor : accessors) {
+
+        accessor.join();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    return {static_cast<double>(accessCount) / elapsed.count(),
+            static_cast<double>(applyCount) / elapsed.count()};
+}
+
+} // namespace
+
+int main()
+{
+    using parameterFramework::utility::TmpFile;
+
+    TmpFile structureFile(structure());
+    TmpFile domainsFile(domains());
+    TmpFile configurationFile(
+        "<?xml version='1.0' encoding='UTF-8'?>"
+        "<ParameterFrameworkConfiguration SystemClassName='bench' TuningAllowed='false'>"
+        "<SubsystemPlugins/><StructureDescriptionFileLocation Path='" +
+        structureFile.getPath() +
+        "'/><SettingsConfiguration><ConfigurableDomainsFileLocation Path='" +
+        domainsFile.getPath() + "'/></SettingsConfiguration></ParameterFrameworkConfiguration>");
+
+    std::cout << threadCount << " accessing threads, one applying thread" << std::endl;
+
+    for (bool bLockSharding : {false, true}) {
+
+        auto throughputs = run(configurationFile.getPath(), bLockSharding);
+
+        std::cout << (bLockSharding ? "Per subsystem lock: " : "Global lock:        ")
+                  << throughputs.first << " accesses/s, " << throughputs.second
+                  << " applications/s" << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
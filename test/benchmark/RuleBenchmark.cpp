@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** Compare the throughput of application rule evaluation between the rule tree walker
+ * (CRule::matches) and its compiled form (CRuleProgram::matches).
+ *
+ * A domain of ruleCount configuration rules is randomly generated, in the same textual form
+ * as used by domain files, then both evaluators are run against random criteria states. Both
+ * must always agree.
+ *
+ * The rules are then split in groups of groupSize, standing for domains, to compare the
+ * search of the first matching rule of each group between compiled rules and their batch
+ * evaluation (CRuleBatch), with its scalar and vectorized test passes.
+ */
+
+#include "CompoundRule.h"
+#include "RuleBatch.h"
+#include "RuleParser.h"
+#include "RuleProgram.h"
+#include "SelectionCriteriaDefinition.h"
+#include "SelectionCriterionType.h"
+#include <log/Logger.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+using std::string;
+
+namespace
+{
+
+const size_t ruleCount = 10000;
+const size_t roundCount = 200;
+const size_t groupSize = 100;
+const int exclusiveCriterionCount = 8;
+const int inclusiveCriterionCount = 4;
+const int valueCount = 4;
+
+class NullLogger : public core::log::ILogger
+{
+public:
+    void info(const string &) override {}
+    void warning(const string &) override {}
+};
+
+class RuleGenerator
+{
+public:
+    RuleGenerator(std::mt19937 &random) : mRandom(random) {}
+
+    /** Configuration rules are typically conjunctions, with nested rules of any type */
+    string rule(int depth) { return compound("All{", depth); }
+
+    /** Conjunction of selective tests, rarely matching */
+    string selectiveRule()
+    {
+        return "All{" + criterion(false) + ", " + criterion(false) + ", " + criterion(false) + "}";
+    }
+
+private:
+    string compound(const string &type, int depth)
+    {
+        string rule = type;
+        int childCount = 1 + pick(4);
+
+        for (int child = 0; child < childCount; child++) {
+
+            if (child != 0) {
+
+                rule += ", ";
+            }
+            rule += (depth > 0 && pick(3) == 0) ? compound(pick(2) ? "All{" : "Any{", depth - 1)
+                                                : criterion();
+        }
+        return rule + "}";
+    }
+
+    string criterion(bool bNegative = true)
+    {
+        // Favor selective verbs, as found in actual configurations
+        static const char *exclusiveVerbs[] = {"Is", "Is", "Is", "IsNot"};
+        static const char *inclusiveVerbs[] = {"Includes", "Includes", "Includes", "Excludes"};
+        const int verbCount = bNegative ? 4 : 3;
+
+        if (pick(exclusiveCriterionCount + inclusiveCriterionCount) < exclusiveCriterionCount) {
+
+            return "Exclusive" + std::to_string(pick(exclusiveCriterionCount)) + " " +
+                   exclusiveVerbs[pick(verbCount)] + " V" + std::to_string(pick(valueCount));
+        }
+        return "Inclusive" + std::to_string(pick(inclusiveCriterionCount)) + " " +
+               inclusiveVerbs[pick(verbCount)] + " B" + std::to_string(pick(valueCount));
+    }
+
+    int pick(int count) { return std::uniform_int_distribution<int>(0, count - 1)(mRandom); }
+
+    std::mt19937 &mRandom;
+};
+
+void randomizeStates(std::vector<CSelectionCriterion *> &criteria, std::mt19937 &random)
+{
+    for (size_t index = 0; index < criteria.size(); index++) {
+
+        int stateCount = index < exclusiveCriterionCount ? valueCount : 1 << valueCount;
+        criteria[index]->setCriterionState(
+            std::uniform_int_distribution<int>(0, stateCount - 1)(random));
+    }
+}
+
+template <class Evaluate>
+double measure(Evaluate evaluate)
+{
+    auto start = std::chrono::steady_clock::now();
+    evaluate();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+/** Compare the search of the first matching program of each group of groupSize programs
+ *
+ * @return false if the evaluators disagree
+ */
+bool searchFirstMatches(const string &title, const std::vector<CRuleProgram> &programs,
+                        std::vector<CSelectionCriterion *> &criteria, std::mt19937 &random)
+{
+    const size_t groupCount = ruleCount / groupSize;
+    CRuleBatch scalarBatch(false);
+    CRuleBatch batch;
+
+    for (auto *ruleBatch : {&scalarBatch, &batch}) {
+
+        for (size_t group = 0; group < groupCount; group++) {
+
+            ruleBatch->beginGroup();
+
+            for (size_t index = 0; index < groupSize; index++) {
+
+                ruleBatch->addProgram(programs[group * groupSize + index]);
+            }
+        }
+    }
+
+    double searchTime = 0;
+    double scalarBatchTime = 0;
+    double batchTime = 0;
+    std::vector<size_t> searchResults(groupCount);
+    std::vector<size_t> scalarBatchResults(groupCount);
+    std::vector<size_t> batchResults(groupCount);
+
+    std::vector<size_t> groups(groupCount);
+    std::iota(groups.begin(), groups.end(), 0);
+
+    auto batchSearch = [&](const CRuleBatch &ruleBatch, std::vector<size_t> &results) {
+        ruleBatch.evaluate(groups);
+        for (size_t group = 0; group < groupCount; group++) {
+            results[group] = ruleBatch.findFirstMatch(group);
+        }
+    };
+
+    for (size_t round = 0; round < roundCount; round++) {
+
+        randomizeStates(criteria, random);
+
+        searchTime += measure([&] {
+            for (size_t group = 0; group < groupCount; group++) {
+                size_t index = 0;
+                while (index < groupSize && !programs[group * groupSize + index].matches()) {
+                    index++;
+                }
+                searchResults[group] = index;
+            }
+        });
+        scalarBatchTime += measure([&] { batchSearch(scalarBatch, scalarBatchResults); });
+        batchTime += measure([&] { batchSearch(batch, batchResults); });
+
+        if (searchResults != scalarBatchResults || searchResults != batchResults) {
+
+            std::cerr << "Batch evaluation disagrees with compiled rules" << std::endl;
+            return false;
+        }
+    }
+
+    double searchCount = static_cast<double>(groupCount * roundCount);
+
+    size_t matchPositionSum = 0;
+    for (size_t position : batchResults) {
+        matchPositionSum += position;
+    }
+    std::cout << groupCount << " groups of " << groupSize << " " << title << ", first match search"
+              << " (last round average match position: " << matchPositionSum / groupCount << ")"
+              << std::endl;
+    std::cout << "Compiled rules: " << searchCount / searchTime << " groups/s" << std::endl;
+    std::cout << "Batch (scalar): " << searchCount / scalarBatchTime << " groups/s" << std::endl;
+    std::cout << "Batch (" << batch.getInstructionSet() << "):   " << searchCount / batchTime
+              << " groups/s" << std::endl;
+    std::cout << "Speedup:        " << searchTime / batchTime << std::endl;
+
+    return true;
+}
+
+} // namespace
+
+int main()
+{
+    NullLogger nullLogger;
+    core::log::Logger logger(nullLogger);
+    std::mt19937 random(42);
+    string error;
+
+    // Criteria
+    CSelectionCriterionType exclusiveType(false);
+    CSelectionCriterionType inclusiveType(true);
+
+    for (int value = 0; value < valueCount; value++) {
+
+        exclusiveType.addValuePair(value, "V" + std::to_string(value), error);
+        inclusiveType.addValuePair(1 << value, "B" + std::to_string(value), error);
+    }
+
+    CSelectionCriteriaDefinition criteriaDefinition;
+    std::vector<CSelectionCriterion *> criteria;
+
+    for (int index = 0; index < exclusiveCriterionCount; index++) {
+
+        criteria.push_back(criteriaDefinition.createSelectionCriterion(
+            "Exclusive" + std::to_string(index), &exclusiveType, logger));
+    }
+    for (int index = 0; index < inclusiveCriterionCount; index++) {
+
+        criteria.push_back(criteriaDefinition.createSelectionCriterion(
+            "Inclusive" + std::to_string(index), &inclusiveType, logger));
+    }
+
+    // Rules
+    RuleGenerator generator(random);
+    std::vector<std::unique_ptr<CCompoundRule>> rules;
+    std::vector<CRuleProgram> programs(ruleCount);
+
+    for (size_t index = 0; index < ruleCount; index++) {
+
+        CRuleParser ruleParser(generator.rule(2), &criteriaDefinition);
+
+        if (!ruleParser.parse(nullptr, error)) {
+
+            std::cerr << "Rule generation error: " << error << std::endl;
+            return EXIT_FAILURE;
+        }
+        rules.emplace_back(ruleParser.grabRootRule());
+        programs[index].compile(rules.back().get());
+    }
+
+    // Evaluation
+    double treeTime = 0;
+    double programTime = 0;
+    std::vector<bool> treeResults(ruleCount);
+    std::vector<bool> programResults(ruleCount);
+
+    for (size_t round = 0; round < roundCount; round++) {
+
+        randomizeStates(criteria, random);
+
+        treeTime += measure([&] {
+            for (size_t index = 0; index < ruleCount; index++) {
+                treeResults[index] = rules[index]->matches();
+            }
+        });
+        programTime += measure([&] {
+            for (size_t index = 0; index < ruleCount; index++) {
+                programResults[index] = programs[index].matches();
+            }
+        });
+
+        if (treeResults != programResults) {
+
+            std::cerr << "Compiled rules disagree with the rule tree" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    double evaluationCount = static_cast<double>(ruleCount * roundCount);
+
+    std::cout << ruleCount << " rules, " << roundCount << " rounds" << std::endl;
+    std::cout << "Tree walker:    " << evaluationCount / treeTime << " rules/s" << std::endl;
+    std::cout << "Compiled rules: " << evaluationCount / programTime << " rules/s" << std::endl;
+    std::cout << "Speedup:        " << treeTime / programTime << std::endl;
+
+    // First match search
+    if (!searchFirstMatches("random rules", programs, criteria, random)) {
+
+        return EXIT_FAILURE;
+    }
+
+    std::vector<CRuleProgram> selectivePrograms(ruleCount);
+
+    for (size_t index = 0; index < ruleCount; index++) {
+
+        CRuleParser ruleParser(generator.selectiveRule(), &criteriaDefinition);
+
+        if (!ruleParser.parse(nullptr, error)) {
+
+            std::cerr << "Rule generation error: " << error << std::endl;
+            return EXIT_FAILURE;
+        }
+        rules.emplace_back(ruleParser.grabRootRule());
+        selectivePrograms[index].compile(rules.back().get());
+    }
+    if (!searchFirstMatches("selective rules", selectivePrograms, criteria, random)) {
+
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -34,7 +34,9 @@
 #include <IntrospectionEntryPoint.h>
 #include "Test.hpp"
 #include <catch.hpp>
+#include <memory>
 #include <string>
+#include <vector>
 
 using std::string;
 
@@ -130,4 +132,80 @@ SCENARIO_METHOD(BoolPF, "Auto sync")
         }
     }
 }
+
+SCENARIO_METHOD(BoolPF, "Concurrent sync")
+{
+    GIVEN ("A Pfw synchronizing subsystems with several threads") {
+        REQUIRE_NOTHROW(setSyncThreadCount(4));
+        CHECK(getSyncThreadCount() == 4);
+        REQUIRE_NOTHROW(start());
+
+        THEN ("Setting the thread count while started fails") {
+            CHECK_THROWS_AS(setSyncThreadCount(1), Exception);
+        }
+        THEN ("Parameter value is false according to the settings") {
+            REQUIRE_FALSE(introspectionSubsystem::getParameterValue());
+        }
+        WHEN ("A parameter is set with autosync off") {
+            REQUIRE_NOTHROW(setAutoSync(false));
+            REQUIRE_NOTHROW(setParameterValue(true));
+            REQUIRE_FALSE(introspectionSubsystem::getParameterValue());
+
+            AND_WHEN ("Synchronizing explicitly") {
+                REQUIRE_NOTHROW(sync());
+
+                THEN ("Sync is done") {
+                    CHECK(introspectionSubsystem::getParameterValue());
+                }
+            }
+        }
+    }
+}
+
+SCENARIO_METHOD(BoolPF, "Dirty tracking", "[dirty tracking]")
+{
+    GIVEN ("A started Pfw with dirty tracking on and autosync off") {
+        REQUIRE_NOTHROW(start());
+
+        std::unique_ptr<CommandHandlerInterface> commandHandler(createCommandHandler());
+        auto command = [&](const string &name, const std::vector<string> &arguments) {
+            string output;
+            CAPTURE(name);
+            CHECK(commandHandler->process(name, arguments, output));
+            return output;
+        };
+        command("setDirtyTracking", {"on"});
+        CHECK(command("getDirtyTracking", {}) == "on");
+        REQUIRE_NOTHROW(setAutoSync(false));
+
+        WHEN ("Synchronizing twice") {
+            REQUIRE_NOTHROW(sync());
+            REQUIRE_NOTHROW(sync());
+
+            THEN ("Everything is sent once after turning tracking on, then skipped") {
+                CHECK(command("getSyncStatistics", {}) == "test: 2 performed, 1 skipped syncs\n");
+            }
+            AND_WHEN ("A parameter is modified and synchronized") {
+                REQUIRE_NOTHROW(setParameterValue(true));
+                REQUIRE_NOTHROW(sync());
+
+                THEN ("The modified parameter is sent") {
+                    CHECK(introspectionSubsystem::getParameterValue());
+                    CHECK(command("getSyncStatistics", {}) ==
+                          "test: 3 performed, 1 skipped syncs\n");
+                }
+            }
+        }
+        WHEN ("Turning tracking off") {
+            command("setDirtyTracking", {"off"});
+            CHECK(command("getDirtyTracking", {}) == "off");
+            REQUIRE_NOTHROW(sync());
+            REQUIRE_NOTHROW(sync());
+
+            THEN ("Nothing is skipped") {
+                CHECK(command("getSyncStatistics", {}) == "test: 3 performed, 0 skipped syncs\n");
+            }
+        }
+    }
+}
 } // namespace parameterFramework
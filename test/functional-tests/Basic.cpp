@@ -32,10 +32,12 @@
 #include "Config.hpp"
 #include "StoreLogger.hpp"
 #include "ParameterFramework.hpp"
+#include "CriterionPF.hpp"
 
 #include <catch.hpp>
 
 #include <list>
+#include <memory>
 #include <string>
 
 #include <cstdio>
@@ -178,4 +180,122 @@ SCENARIO_METHOD(ParameterFramework, "Raw value space")
     }
 }
 
+SCENARIO_METHOD(ParameterFramework, "Numerous domains", "[domains]")
+{
+    GIVEN ("More domains than the children indexing threshold") {
+        REQUIRE_NOTHROW(start());
+        REQUIRE_NOTHROW(setTuningMode(true));
+        std::unique_ptr<CommandHandlerInterface> commandHandler(createCommandHandler());
+        std::string output;
+        for (int domain = 0; domain < 40; domain++) {
+            REQUIRE(commandHandler->process("createDomain", {"domain" + std::to_string(domain)},
+                                            output));
+        }
+        THEN ("Each domain is found by name") {
+            for (int domain = 0; domain < 40; domain++) {
+                CHECK(commandHandler->process("listConfigurations",
+                                              {"domain" + std::to_string(domain)}, output));
+            }
+            CHECK_FALSE(commandHandler->process("listConfigurations", {"domain40"}, output));
+            CHECK_FALSE(commandHandler->process("createDomain", {"domain12"}, output));
+        }
+        WHEN ("Renaming and deleting domains") {
+            REQUIRE(commandHandler->process("renameDomain", {"domain3", "renamed"}, output));
+            REQUIRE(commandHandler->process("deleteDomain", {"domain7"}, output));
+            THEN ("Lookups follow the new names") {
+                CHECK(commandHandler->process("listConfigurations", {"renamed"}, output));
+                CHECK_FALSE(commandHandler->process("listConfigurations", {"domain3"}, output));
+                CHECK_FALSE(commandHandler->process("listConfigurations", {"domain7"}, output));
+                CHECK(commandHandler->process("createDomain", {"domain3"}, output));
+                CHECK(commandHandler->process("listConfigurations", {"domain3"}, output));
+                CHECK(commandHandler->process("listConfigurations", {"domain8"}, output));
+            }
+        }
+    }
+}
+
+SCENARIO_METHOD(ParameterFramework, "Startup profile", "[startup profile]")
+{
+    GIVEN ("A started parameter framework") {
+        REQUIRE_NOTHROW(start());
+
+        WHEN ("Getting the startup profile") {
+            std::string profile = getStartupProfile();
+            INFO(profile);
+
+            THEN ("Every start phase is reported, in order") {
+                size_t position = 0;
+                for (const char *phase : {"configuration", "plugins", "structure", "settings",
+                                          "init", "backSynchronization", "validation", "apply"}) {
+                    auto found = profile.find(std::string("{\"name\": \"") + phase + "\"");
+                    CHECK(found != std::string::npos);
+                    CHECK(found >= position);
+                    position = found;
+                }
+            }
+            THEN ("Files, mapping and back synchronization are broken down") {
+                CHECK(profile.find("\"files\": [{\"name\": \"") != std::string::npos);
+                CHECK(profile.find("\"mapping\": [{\"name\": \"test\"") != std::string::npos);
+                CHECK(profile.find("\"subsystems\": [{\"name\": \"test\"") !=
+                      std::string::npos);
+            }
+            THEN ("The remote command reports the same profile") {
+                std::unique_ptr<CommandHandlerInterface> commandHandler(createCommandHandler());
+                std::string output;
+                REQUIRE(commandHandler->process("getStartupProfile", {}, output));
+                CHECK(output == profile);
+            }
+        }
+    }
+}
+
+SCENARIO_METHOD(CriterionPF, "Apply statistics", "[apply statistics]")
+{
+    GIVEN ("A parameter framework recording latencies from start") {
+        setApplyStatisticsEnabled(true);
+        CHECK(isApplyStatisticsEnabled());
+        REQUIRE_NOTHROW(start());
+
+        THEN ("The initial application is recorded for each domain and subsystem") {
+            auto statistics = getApplyStatistics();
+            CHECK(statistics.apply.count == 1);
+            CHECK(statistics.domains["ModeDomain"].count == 1);
+            CHECK(statistics.domains["OtherDomain"].count == 1);
+            CHECK(statistics.subsystems["test"].count != 0);
+            CHECK(statistics.apply.max >= statistics.apply.mean);
+        }
+        WHEN ("Only one criterion changes") {
+            setCriterion("Mode", 1);
+            applyConfigurations();
+
+            THEN ("Only the domain switching configuration records a new latency") {
+                auto statistics = getApplyStatistics();
+                CHECK(statistics.apply.count == 2);
+                CHECK(statistics.domains["ModeDomain"].count == 2);
+                CHECK(statistics.domains["OtherDomain"].count == 1);
+            }
+            AND_WHEN ("Resetting the statistics") {
+                command("resetApplyStatistics");
+                auto output = command("getApplyStatistics");
+
+                THEN ("Nothing is recorded anymore") {
+                    CHECK(output.find("Applications: 0 samples") != std::string::npos);
+                    CHECK(output.find("ModeDomain: 0 samples") != std::string::npos);
+                    CHECK(getApplyStatistics().subsystems["test"].count == 0);
+                }
+            }
+        }
+        WHEN ("Turning recording off") {
+            command("setApplyStatistics", {"off"});
+            setCriterion("Mode", 1);
+            applyConfigurations();
+
+            THEN ("Nothing new is recorded") {
+                CHECK_FALSE(isApplyStatisticsEnabled());
+                CHECK(getApplyStatistics().apply.count == 1);
+            }
+        }
+    }
+}
+
 } // namespace parameterFramework
@@ -35,7 +35,9 @@
 
 #include <catch.hpp>
 
+#include <memory>
 #include <string>
+#include <vector>
 
 using std::string;
 
@@ -161,4 +163,60 @@ SCENARIO_METHOD(BitParameterPF, "BitParameter types", "[BitParameter types]")
         }
     }
 }
+SCENARIO_METHOD(BitParameterPF, "BitParameter restore", "[BitParameter types]")
+{
+    GIVEN ("Two domains sharing a bit parameter block") {
+        REQUIRE_NOTHROW(start());
+
+        std::unique_ptr<CommandHandlerInterface> commandHandler(createCommandHandler());
+        auto command = [&](const string &name, const std::vector<string> &arguments) {
+            string output;
+            CAPTURE(name);
+            CAPTURE(output);
+            CHECK(commandHandler->process(name, arguments, output));
+        };
+        auto get = [&](const string &path) {
+            string value;
+            getParameter(path, value);
+            return value;
+        };
+        command("setTuningMode", {"on"});
+        command("setAutoSync", {"off"});
+        command("createDomain", {"BoolDomain"});
+        command("addElement", {"BoolDomain", "/test/test/nominal/bool"});
+        command("createDomain", {"BitsDomain"});
+        command("addElement", {"BitsDomain", "/test/test/nominal/twobits"});
+        command("addElement", {"BitsDomain", "/test/test/nominal/treebits"});
+
+        command("setParameter", {"/test/test/nominal/bool", "1"});
+        command("setParameter", {"/test/test/nominal/twobits", "3"});
+        command("setParameter", {"/test/test/nominal/treebits", "5"});
+        command("createConfiguration", {"BoolDomain", "Conf"});
+        command("createConfiguration", {"BitsDomain", "Conf"});
+
+        command("setParameter", {"/test/test/nominal/bool", "0"});
+        command("setParameter", {"/test/test/nominal/twobits", "1"});
+        command("setParameter", {"/test/test/nominal/treebits", "2"});
+
+        WHEN ("Restoring the configuration of one domain") {
+            command("restoreConfiguration", {"BitsDomain", "Conf"});
+            THEN ("Only the bits of that domain are restored") {
+                CHECK(get("/test/test/nominal/bool") == "0");
+                CHECK(get("/test/test/nominal/twobits") == "3");
+                CHECK(get("/test/test/nominal/treebits") == "5");
+            }
+            AND_WHEN ("The configuration is modified and restored again") {
+                command("setConfigurationParameter",
+                        {"BitsDomain", "Conf", "/test/test/nominal/treebits", "6"});
+                command("setParameter", {"/test/test/nominal/bool", "1"});
+                command("restoreConfiguration", {"BitsDomain", "Conf"});
+                THEN ("The modification is restored") {
+                    CHECK(get("/test/test/nominal/bool") == "1");
+                    CHECK(get("/test/test/nominal/twobits") == "3");
+                    CHECK(get("/test/test/nominal/treebits") == "6");
+                }
+            }
+        }
+    }
+}
 }
@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "CriterionPF.hpp"
+#include <catch.hpp>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using std::string;
+
+namespace parameterFramework
+{
+
+SCENARIO_METHOD(CriterionPF, "Criterion driven configuration application", "[criterion]")
+{
+    GIVEN ("A started parameter framework") {
+        REQUIRE_NOTHROW(start());
+
+        THEN ("Configurations matching the initial criteria are applied") {
+            CHECK(get("/test/test/modeParam") == "1");
+            CHECK(get("/test/test/otherParam") == "10");
+        }
+        WHEN ("Applying without any criterion change") {
+            applyConfigurations();
+            THEN ("Parameters are unchanged") {
+                CHECK(get("/test/test/modeParam") == "1");
+                CHECK(get("/test/test/otherParam") == "10");
+            }
+        }
+        WHEN ("Only one criterion changes") {
+            setCriterion("Mode", 1);
+            THEN ("Nothing is applied before the application request") {
+                CHECK(get("/test/test/modeParam") == "1");
+            }
+            applyConfigurations();
+            THEN ("Only the domain depending on it switches configuration") {
+                CHECK(get("/test/test/modeParam") == "2");
+                CHECK(get("/test/test/otherParam") == "10");
+            }
+            AND_WHEN ("The other criterion changes") {
+                setCriterion("Other", 1);
+                applyConfigurations();
+                THEN ("The other domain switches configuration") {
+                    CHECK(get("/test/test/modeParam") == "2");
+                    CHECK(get("/test/test/otherParam") == "20");
+                }
+            }
+            AND_WHEN ("The criterion goes back to its initial state") {
+                setCriterion("Mode", 0);
+                applyConfigurations();
+                THEN ("The initial configuration is applied again") {
+                    CHECK(get("/test/test/modeParam") == "1");
+                }
+            }
+        }
+    }
+}
+
+SCENARIO_METHOD(CriterionPF, "Decision cache", "[criterion][decision cache]")
+{
+    GIVEN ("A started parameter framework with the decision cache on") {
+        REQUIRE_NOTHROW(start());
+
+        command("setDecisionCache", {"on"});
+        CHECK(command("getDecisionCache") == "on");
+
+        WHEN ("Switching a criterion back and forth") {
+            for (int state : {1, 0, 1, 0}) {
+                setCriterion("Mode", state);
+                applyConfigurations();
+                CHECK(get("/test/test/modeParam") == (state ? "2" : "1"));
+            }
+            THEN ("Only the first occurrence of each criteria combination is a miss") {
+                CHECK(command("getDecisionCacheStatistics") ==
+                      "ModeDomain: 2 hits, 2 misses, 2 cached decisions\n"
+                      "OtherDomain: 0 hits, 0 misses, 0 cached decisions\n");
+            }
+            AND_WHEN ("Changing a rule") {
+                command("setTuningMode", {"on"});
+                command("setRule", {"ModeDomain", "on", "All{Mode Is off}"});
+                command("setRule", {"ModeDomain", "off", "All{Mode Is on}"});
+                command("setTuningMode", {"off"});
+                setCriterion("Mode", 1);
+                applyConfigurations();
+                THEN ("Cached decisions are dropped and the new rules are honored") {
+                    CHECK(get("/test/test/modeParam") == "1");
+                    // Leaving tuning mode and the criterion change both missed
+                    CHECK(command("getDecisionCacheStatistics") ==
+                          "ModeDomain: 2 hits, 4 misses, 2 cached decisions\n"
+                          "OtherDomain: 0 hits, 1 misses, 1 cached decisions\n");
+                }
+            }
+        }
+    }
+}
+
+SCENARIO_METHOD(CriterionPF, "Delta restore", "[criterion][delta]")
+{
+    GIVEN ("A domain whose configurations only differ by one parameter") {
+        REQUIRE_NOTHROW(start());
+
+        command("setTuningMode", {"on"});
+        command("createDomain", {"GainDomain"});
+        command("addElement", {"GainDomain", "/test/test/gainParam"});
+        command("addElement", {"GainDomain", "/test/test/volumeParam"});
+        command("setParameter", {"/test/test/volumeParam", "5"});
+        command("setParameter", {"/test/test/gainParam", "1"});
+        command("createConfiguration", {"GainDomain", "low"});
+        command("setRule", {"GainDomain", "low", "All{Other Is off}"});
+        command("setParameter", {"/test/test/gainParam", "2"});
+        command("createConfiguration", {"GainDomain", "high"});
+        command("saveConfiguration", {"GainDomain", "high"});
+        command("setRule", {"GainDomain", "high", "All{Other Is on}"});
+        command("setTuningMode", {"off"});
+
+        CHECK(get("/test/test/gainParam") == "1");
+        CHECK(get("/test/test/volumeParam") == "5");
+
+        WHEN ("Switching configuration back and forth") {
+            for (int state : {1, 0, 1}) {
+                setCriterion("Other", state);
+                applyConfigurations();
+                CHECK(get("/test/test/gainParam") == (state ? "2" : "1"));
+                CHECK(get("/test/test/volumeParam") == "5");
+            }
+        }
+        WHEN ("A configuration is modified in between") {
+            setCriterion("Other", 1);
+            applyConfigurations();
+            setCriterion("Other", 0);
+            applyConfigurations();
+
+            command("setTuningMode", {"on"});
+            command("setConfigurationParameter",
+                    {"GainDomain", "high", "/test/test/volumeParam", "9"});
+            command("setTuningMode", {"off"});
+
+            setCriterion("Other", 1);
+            applyConfigurations();
+            THEN ("The modification is restored") {
+                CHECK(get("/test/test/gainParam") == "2");
+                CHECK(get("/test/test/volumeParam") == "9");
+            }
+        }
+    }
+}
+
+SCENARIO_METHOD(CriterionPF, "Concurrent application", "[criterion][thread]")
+{
+    GIVEN ("A parameter framework applying domains with several threads") {
+        REQUIRE_NOTHROW(setApplyThreadCount(4));
+        CHECK(getApplyThreadCount() == 4);
+        REQUIRE_NOTHROW(start());
+
+        THEN ("Setting the thread count while started fails") {
+            CHECK_THROWS_AS(setApplyThreadCount(1), Exception);
+        }
+        THEN ("Configurations matching the initial criteria are applied") {
+            CHECK(get("/test/test/modeParam") == "1");
+            CHECK(get("/test/test/otherParam") == "10");
+        }
+        WHEN ("Both criteria change") {
+            setCriterion("Mode", 1);
+            setCriterion("Other", 1);
+            applyConfigurations();
+            THEN ("Both domains switch configuration") {
+                CHECK(get("/test/test/modeParam") == "2");
+                CHECK(get("/test/test/otherParam") == "20");
+            }
+        }
+        WHEN ("A later domain shares an element with a former one") {
+            command("setTuningMode", {"on"});
+            command("createDomain", {"OverrideDomain"});
+            command("addElement", {"OverrideDomain", "/test/test/modeParam"});
+            command("setParameter", {"/test/test/modeParam", "42"});
+            command("createConfiguration", {"OverrideDomain", "override"});
+            command("setRule", {"OverrideDomain", "override", "All{Mode Is on}"});
+            command("setTuningMode", {"off"});
+
+            setCriterion("Mode", 1);
+            applyConfigurations();
+            THEN ("Domains sharing the element are applied in order") {
+                CHECK(get("/test/test/modeParam") == "42");
+                CHECK(get("/test/test/otherParam") == "10");
+            }
+        }
+    }
+}
+
+SCENARIO_METHOD(CriterionPF, "Asynchronous application", "[criterion][async]")
+{
+    GIVEN ("A parameter framework not started") {
+        THEN ("Asynchronous application requests are dropped") {
+            CHECK_FALSE(applyConfigurationsAsync());
+        }
+    }
+    GIVEN ("A started parameter framework") {
+        REQUIRE_NOTHROW(start());
+
+        WHEN ("A criterion changes and an asynchronous application is requested") {
+            setCriterion("Mode", 1);
+
+            std::promise<ApplyReport> applied;
+            REQUIRE(applyConfigurationsAsync(
+                [&](const ApplyReport &report) { applied.set_value(report); }));
+
+            auto future = applied.get_future();
+            REQUIRE(future.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+            auto report = future.get();
+
+            THEN ("The report lists the domain which switched configuration") {
+                REQUIRE(report.appliedConfigurations.size() == 1);
+                CHECK(report.appliedConfigurations[0].domain == "ModeDomain");
+                CHECK(report.appliedConfigurations[0].configuration == "on");
+                CHECK(report.syncErrors.empty());
+                CHECK(get("/test/test/modeParam") == "2");
+            }
+        }
+        WHEN ("A burst of asynchronous applications is requested") {
+            setCriterion("Other", 1);
+
+            const size_t requestCount = 10;
+            std::mutex mutex;
+            std::condition_variable condition;
+            std::vector<size_t> reportSizes;
+
+            for (size_t request = 0; request < requestCount; request++) {
+                REQUIRE(applyConfigurationsAsync([&](const ApplyReport &report) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    reportSizes.push_back(report.appliedConfigurations.size());
+                    condition.notify_one();
+                }));
+            }
+            std::unique_lock<std::mutex> lock(mutex);
+            REQUIRE(condition.wait_for(lock, std::chrono::seconds(10),
+                                       [&] { return reportSizes.size() == requestCount; }));
+
+            THEN ("Every request is served by an application reporting the switch once") {
+                // Coalesced requests share the report of their application
+                CHECK(reportSizes.front() == 1);
+                CHECK(std::count(begin(reportSizes), end(reportSizes), 1) +
+                          std::count(begin(reportSizes), end(reportSizes), 0) ==
+                      requestCount);
+                CHECK(get("/test/test/otherParam") == "20");
+            }
+        }
+    }
+}
+
+SCENARIO_METHOD(CriterionPF, "Criteria transaction", "[criterion][transaction]")
+{
+    GIVEN ("A parameter framework not started") {
+        CriteriaTransaction transaction;
+        transaction.setCriterionState(getSelectionCriterion("Mode"), 1);
+
+        THEN ("Committing a transaction publishes nothing") {
+            CHECK_FALSE(applyCriteriaTransaction(transaction));
+            CHECK(getSelectionCriterion("Mode")->getCriterionState() == 0);
+        }
+    }
+    GIVEN ("A started parameter framework") {
+        REQUIRE_NOTHROW(start());
+
+        WHEN ("Staging both criteria in a transaction") {
+            CriteriaTransaction transaction;
+            transaction.setCriterionState(getSelectionCriterion("Mode"), 0);
+            transaction.setCriterionState(getSelectionCriterion("Mode"), 1);
+            transaction.setCriterionState(getSelectionCriterion("Other"), 1);
+
+            THEN ("Nothing is published before commit") {
+                CHECK(getSelectionCriterion("Mode")->getCriterionState() == 0);
+                CHECK(get("/test/test/modeParam") == "1");
+            }
+            AND_WHEN ("Committing the transaction") {
+                REQUIRE(applyCriteriaTransaction(transaction));
+
+                THEN ("The last staged states are published and applied") {
+                    CHECK(getSelectionCriterion("Mode")->getCriterionState() == 1);
+                    CHECK(getSelectionCriterion("Other")->getCriterionState() == 1);
+                    CHECK(get("/test/test/modeParam") == "2");
+                    CHECK(get("/test/test/otherParam") == "20");
+                }
+            }
+        }
+    }
+}
+
+} // namespace parameterFramework
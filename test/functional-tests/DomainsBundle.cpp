@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Config.hpp"
+#include "ParameterFramework.hpp"
+#include "TmpFile.hpp"
+#include "Test.hpp"
+#include <catch.hpp>
+#include <string>
+
+using std::string;
+
+namespace parameterFramework
+{
+
+/** Parameter framework whose domains exercise every kind of rule and a sequence aware domain. */
+struct BundlePF : public ParameterFramework
+{
+    BundlePF(const Config &config = createConfig()) : ParameterFramework{config}
+    {
+        string error;
+
+        auto mode = createSelectionCriterionType(false);
+        REQUIRE(mode->addValuePair(0, "off", error));
+        REQUIRE(mode->addValuePair(1, "on", error));
+        REQUIRE(createSelectionCriterion("Mode", mode) != nullptr);
+
+        auto flags = createSelectionCriterionType(true);
+        REQUIRE(flags->addValuePair(1, "a", error));
+        REQUIRE(flags->addValuePair(2, "b", error));
+        REQUIRE(createSelectionCriterion("Flags", flags) != nullptr);
+    }
+
+    string get(const string &path)
+    {
+        string value;
+        getParameter(path, value);
+        return value;
+    }
+
+    static Config createConfig()
+    {
+        Config config;
+        config.instances = R"(<IntegerParameter Name="mode" Size="8"/>
+                              <ParameterBlock Name="block">
+                                  <IntegerParameter Name="first" Size="16"/>
+                                  <IntegerParameter Name="second" Size="16"/>
+                              </ParameterBlock>)";
+        config.domains = R"(
+            <ConfigurableDomain Name="ModeDomain">
+                <Configurations>
+                    <Configuration Name="on">
+                        <CompoundRule Type="Any">
+                            <SelectionCriterionRule SelectionCriterion="Mode"
+                                                    MatchesWhen="Is" Value="on"/>
+                            <CompoundRule Type="All">
+                                <SelectionCriterionRule SelectionCriterion="Flags"
+                                                        MatchesWhen="Includes" Value="a"/>
+                                <SelectionCriterionRule SelectionCriterion="Flags"
+                                                        MatchesWhen="Excludes" Value="b"/>
+                            </CompoundRule>
+                        </CompoundRule>
+                    </Configuration>
+                    <Configuration Name="default">
+                        <CompoundRule Type="All"/>
+                    </Configuration>
+                </Configurations>
+                <ConfigurableElements>
+                    <ConfigurableElement Path="/test/test/mode"/>
+                </ConfigurableElements>
+                <Settings>
+                    <Configuration Name="on">
+                        <ConfigurableElement Path="/test/test/mode">
+                            <IntegerParameter Name="mode">11</IntegerParameter>
+                        </ConfigurableElement>
+                    </Configuration>
+                    <Configuration Name="default">
+                        <ConfigurableElement Path="/test/test/mode">
+                            <IntegerParameter Name="mode">22</IntegerParameter>
+                        </ConfigurableElement>
+                    </Configuration>
+                </Settings>
+            </ConfigurableDomain>
+            <ConfigurableDomain Name="BlockDomain" SequenceAware="true">
+                <Configurations>
+                    <Configuration Name="only">
+                        <CompoundRule Type="All">
+                            <SelectionCriterionRule SelectionCriterion="Mode"
+                                                    MatchesWhen="IsNot" Value="on"/>
+                        </CompoundRule>
+                    </Configuration>
+                    <Configuration Name="unruled"/>
+                </Configurations>
+                <ConfigurableElements>
+                    <ConfigurableElement Path="/test/test/block/first"/>
+                    <ConfigurableElement Path="/test/test/block/second"/>
+                </ConfigurableElements>
+                <Settings>
+                    <Configuration Name="only">
+                        <ConfigurableElement Path="/test/test/block/second">
+                            <IntegerParameter Name="second">2</IntegerParameter>
+                        </ConfigurableElement>
+                        <ConfigurableElement Path="/test/test/block/first">
+                            <IntegerParameter Name="first">1</IntegerParameter>
+                        </ConfigurableElement>
+                    </Configuration>
+                </Settings>
+            </ConfigurableDomain>)";
+        return config;
+    }
+};
+
+/** @return a configuration with no domain but the given bundle */
+static Config bundleConfig(const string &bundlePath, const string &instances)
+{
+    Config config = BundlePF::createConfig();
+    config.domains = "";
+    config.domainsBundle = bundlePath;
+    config.instances = instances;
+    return config;
+}
+
+SCENARIO("Domains bundle", "[domains bundle]")
+{
+    GIVEN ("A bundle compiled from the domains of a started parameter framework") {
+        BundlePF compiled;
+        REQUIRE_NOTHROW(compiled.start());
+
+        utility::TmpFile bundle("");
+        REQUIRE_NOTHROW(compiled.exportDomainsBundle(bundle.getPath()));
+
+        auto instances = BundlePF::createConfig().instances;
+
+        WHEN ("Starting a parameter framework from the bundle") {
+            BundlePF loaded(bundleConfig(bundle.getPath(), instances));
+            REQUIRE_NOTHROW(loaded.start());
+
+            THEN ("Domains, rules and settings are the compiled ones") {
+                CHECK(loaded.exportDomainsXml() == compiled.exportDomainsXml());
+            }
+            THEN ("Applicable configurations are applied") {
+                CHECK(loaded.get("/test/test/mode") == "22");
+                CHECK(loaded.get("/test/test/block/first") == "1");
+                CHECK(loaded.get("/test/test/block/second") == "2");
+            }
+            AND_WHEN ("Criteria change") {
+                loaded.getSelectionCriterion("Flags")->setCriterionState(1);
+                loaded.applyConfigurations();
+                THEN ("Rules are evaluated as the compiled ones") {
+                    CHECK(loaded.get("/test/test/mode") == "11");
+                }
+            }
+        }
+        WHEN ("Starting a parameter framework of another structure from the bundle") {
+            BundlePF other(bundleConfig(
+                bundle.getPath(), instances + R"(<IntegerParameter Name="new" Size="8"/>)"));
+            REQUIRE_NOTHROW(other.start());
+
+            THEN ("The bundle is rejected for the XML domains") {
+                CHECK(other.exportDomainsXml().find("ModeDomain") == string::npos);
+            }
+        }
+        WHEN ("Starting a parameter framework whose parameter types changed from the bundle") {
+            auto retyped = instances;
+            retyped.replace(retyped.find(R"(Name="first" Size="16")"),
+                            string(R"(Name="first" Size="16")").size(),
+                            R"(Name="first" Size="16" Signed="true" Min="-10" Max="10")");
+            BundlePF other(bundleConfig(bundle.getPath(), retyped));
+            REQUIRE_NOTHROW(other.start());
+
+            THEN ("The bundle is rejected for the XML domains") {
+                CHECK(other.exportDomainsXml().find("ModeDomain") == string::npos);
+            }
+        }
+        WHEN ("Starting a parameter framework from a truncated bundle") {
+            utility::TmpFile truncated("PFWB");
+            BundlePF other(bundleConfig(truncated.getPath(), instances));
+            REQUIRE_NOTHROW(other.start());
+
+            THEN ("The bundle is rejected for the XML domains") {
+                CHECK(other.exportDomainsXml().find("ModeDomain") == string::npos);
+            }
+        }
+    }
+}
+
+} // namespace parameterFramework
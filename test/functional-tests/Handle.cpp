@@ -35,6 +35,7 @@
 
 #include "ParameterFramework.hpp"
 #include "ElementHandle.hpp"
+#include "CriterionPF.hpp"
 
 #include <catch.hpp>
 
@@ -43,6 +44,9 @@
 
 #include <string>
 #include <list>
+#include <memory>
+#include <atomic>
+#include <thread>
 
 #include <stdlib.h>
 
@@ -662,4 +666,415 @@ SCENARIO_METHOD(SettingsTestPF, "Handle Get/Set as various kinds", "[handler][dy
         }
     }
 }
+
+SCENARIO_METHOD(AllParamsPF, "Parameter transaction", "[handler][transaction]")
+{
+    GIVEN ("A parameter transaction") {
+        std::unique_ptr<ParameterTransaction> transaction(createParameterTransaction());
+        ElementHandle integer{*this, "/test/test/integer"};
+        ElementHandle integerArray{*this, "/test/test/integer_array"};
+        ElementHandle stringParam{*this, "/test/test/string"};
+        REQUIRE_NOTHROW(integer.setAsInteger(50));
+        REQUIRE_NOTHROW(stringParam.setAsString("initial"));
+        string error;
+        uint32_t value;
+        string stringValue;
+
+        WHEN ("Writes are queued") {
+            CHECK(transaction->setAsInteger(integer.getWrapped(), 60, error));
+            CHECK(transaction->setAsSignedIntegerArray(integerArray.getWrapped(), {1, -2, 3, -4},
+                                                       error));
+            CHECK(transaction->setValue("/test/test/string", "batched", error));
+            CHECK(transaction->getWriteCount() == 3);
+
+            THEN ("Nothing is written before commit") {
+                REQUIRE_NOTHROW(integer.getAsInteger(value));
+                CHECK(value == 50);
+            }
+            WHEN ("The transaction is committed") {
+                CAPTURE(error);
+                REQUIRE(transaction->commit(error));
+                THEN ("All writes are done") {
+                    std::vector<int32_t> arrayValue;
+                    REQUIRE_NOTHROW(integer.getAsInteger(value));
+                    CHECK(value == 60);
+                    REQUIRE_NOTHROW(integerArray.getAsSignedIntegerArray(arrayValue));
+                    CHECK(arrayValue == (std::vector<int32_t>{1, -2, 3, -4}));
+                    REQUIRE_NOTHROW(stringParam.getAsString(stringValue));
+                    CHECK(stringValue == "batched");
+                    CHECK(transaction->getWriteCount() == 0);
+                }
+            }
+        }
+        WHEN ("Writes can not be queued") {
+            CHECK_FALSE(transaction->setAsIntegerArray(integer.getWrapped(), {1, 2}, error));
+            CHECK_FALSE(transaction->setValue("/test/test/unknown", "1", error));
+            THEN ("Nothing is queued") {
+                CHECK(transaction->getWriteCount() == 0);
+            }
+        }
+        WHEN ("A queued write is out of range") {
+            CHECK(transaction->setAsInteger(integer.getWrapped(), 60, error));
+            CHECK(transaction->setAsString(stringParam.getWrapped(), "batched", error));
+            CHECK(transaction->setAsInteger(integer.getWrapped(), 70, error));
+            CHECK(transaction->setAsSignedIntegerArray(integerArray.getWrapped(), {1, -2, 3, 40},
+                                                       error));
+            THEN ("The commit fails and no write is kept") {
+                CHECK_FALSE(transaction->commit(error));
+                REQUIRE_NOTHROW(integer.getAsInteger(value));
+                CHECK(value == 50);
+                REQUIRE_NOTHROW(stringParam.getAsString(stringValue));
+                CHECK(stringValue == "initial");
+            }
+        }
+        WHEN ("A bit parameter write is followed by an out of range write") {
+            ElementHandle bit{*this, "/test/test/bit_block/six"};
+            REQUIRE_NOTHROW(bit.setAsInteger(3));
+            CHECK(transaction->setAsInteger(bit.getWrapped(), 9, error));
+            CHECK(transaction->setAsInteger(integer.getWrapped(), 60, error));
+            CHECK(transaction->setAsSignedIntegerArray(integerArray.getWrapped(), {1, -2, 3, 40},
+                                                       error));
+            THEN ("The commit fails and the bit parameter keeps its value") {
+                CHECK_FALSE(transaction->commit(error));
+                // Publish the blackboard as left by the failed commit
+                REQUIRE_NOTHROW(stringParam.setAsString("published"));
+                REQUIRE_NOTHROW(bit.getAsInteger(value));
+                CHECK(value == 3);
+                REQUIRE_NOTHROW(integer.getAsInteger(value));
+                CHECK(value == 50);
+            }
+        }
+    }
+}
+
+SCENARIO_METHOD(AllParamsPF, "Path index", "[handler][path index]")
+{
+    GIVEN ("A tuned parameter framework whose path index statistics are reset") {
+        REQUIRE_NOTHROW(setTuningMode(true));
+        std::unique_ptr<CommandHandlerInterface> commandHandler(createCommandHandler());
+        string output;
+        REQUIRE(commandHandler->process("resetPathIndexStatistics", {}, output));
+
+        WHEN ("Accessing an array element by index") {
+            REQUIRE(commandHandler->process("setParameter", {"/test/test/integer_array/2", "7"},
+                                            output));
+            REQUIRE(commandHandler->process("getParameter", {"/test/test/integer_array/2"},
+                                            output));
+            THEN ("The indexed element is accessed") {
+                CHECK(output == "7");
+                REQUIRE(commandHandler->process("getParameter", {"/test/test/integer_array"},
+                                                output));
+                CHECK(output == "-10 -10 7 -10");
+            }
+        }
+        WHEN ("Accessing invalid paths") {
+            THEN ("Errors are the navigation ones") {
+                CHECK_FALSE(commandHandler->process("getParameter",
+                                                    {"/test/test/integer_array/4"}, output));
+                CHECK(output.find("Provided index out of range") != string::npos);
+                CHECK_FALSE(
+                    commandHandler->process("getParameter", {"/test/test/integer/1"}, output));
+                CHECK(output.find("Path not found: /test/test/integer/1") != string::npos);
+                CHECK_FALSE(
+                    commandHandler->process("getParameter", {"/test/test/unknown"}, output));
+                CHECK(output.find("Path not found: /test/test/unknown") != string::npos);
+                CHECK_FALSE(commandHandler->process("getParameter", {"/test/test"}, output));
+                CHECK(output.find("/test/test because it is not a parameter") != string::npos);
+            }
+        }
+        WHEN ("Locating elements, some of them through the navigation") {
+            REQUIRE(commandHandler->process("getElementSize", {"/test/test/bit_block/six"},
+                                            output));
+            REQUIRE(commandHandler->process("getElementSize", {"/test/test/bit_block/"}, output));
+            CHECK_FALSE(commandHandler->process("getElementSize", {"/test/test/none"}, output));
+            REQUIRE(commandHandler->process("getPathIndexStatistics", {}, output));
+
+            THEN ("Only well formed existing paths are hits") {
+                CHECK(output.find(" bytes, 1/3 hits (33%)") != string::npos);
+            }
+        }
+    }
+}
+
+SCENARIO_METHOD(AllParamsPF, "Bound parameters", "[handler][bind]")
+{
+    GIVEN ("Parameters bound to typed accessors") {
+        ElementHandle integer{*this, "/test/test/integer"};
+        ElementHandle boolean{*this, "/test/test/bool"};
+        ElementHandle fixedPoint{*this, "/test/test/fix_point"};
+        string error;
+        auto boundInteger = integer.getWrapped().bind<uint32_t>(error);
+        auto boundSigned = integer.getWrapped().bind<int32_t>(error);
+        auto boundBoolean = boolean.getWrapped().bind<bool>(error);
+        auto boundFixedPoint = fixedPoint.getWrapped().bind<double>(error);
+        CAPTURE(error);
+        REQUIRE(boundInteger.isBound());
+        REQUIRE(boundSigned.isBound());
+        REQUIRE(boundBoolean.isBound());
+        REQUIRE(boundFixedPoint.isBound());
+
+        THEN ("Values are written and read back as through handles") {
+            uint32_t value;
+            int32_t signedValue;
+            CHECK(boundInteger.set(100));
+            REQUIRE_NOTHROW(integer.getAsInteger(value));
+            CHECK(value == 100);
+            REQUIRE(boundSigned.get(signedValue));
+            CHECK(signedValue == 100);
+            REQUIRE_NOTHROW(integer.setAsInteger(50));
+            REQUIRE(boundInteger.get(value));
+            CHECK(value == 50);
+
+            bool boolValue = false;
+            CHECK(boundBoolean.set(true));
+            REQUIRE_NOTHROW(boolean.getAsBoolean(boolValue));
+            CHECK(boolValue);
+            REQUIRE_NOTHROW(boolean.setAsBoolean(false));
+            REQUIRE(boundBoolean.get(boolValue));
+            CHECK_FALSE(boolValue);
+
+            double doubleValue;
+            CHECK(boundFixedPoint.set(1.25));
+            REQUIRE_NOTHROW(fixedPoint.getAsDouble(doubleValue));
+            CHECK(doubleValue == 1.25);
+            REQUIRE_NOTHROW(fixedPoint.setAsDouble(-2.5));
+            REQUIRE(boundFixedPoint.get(doubleValue));
+            CHECK(doubleValue == -2.5);
+        }
+        THEN ("Out of range values are not written") {
+            uint32_t value;
+            REQUIRE_NOTHROW(integer.setAsInteger(50));
+            CHECK_FALSE(boundInteger.set(200));
+            CHECK_FALSE(boundInteger.set(20));
+            CHECK_FALSE(boundSigned.set(-1));
+            CHECK_FALSE(boundFixedPoint.set(10));
+            REQUIRE(boundInteger.get(value));
+            CHECK(value == 50);
+        }
+        THEN ("Writes are ignored in tuning mode") {
+            uint32_t value;
+            REQUIRE_NOTHROW(integer.setAsInteger(50));
+            REQUIRE_NOTHROW(setTuningMode(true));
+            CHECK(boundInteger.set(100));
+            REQUIRE(boundInteger.get(value));
+            CHECK(value == 50);
+        }
+    }
+    GIVEN ("Elements that can not be bound") {
+        string error;
+        THEN ("Binding fails with an error") {
+            ElementHandle integer{*this, "/test/test/integer"};
+            CHECK_FALSE(integer.getWrapped().bind<double>(error).isBound());
+            CHECK(error.find("unsupported conversion") != string::npos);
+            CHECK_FALSE(integer.getWrapped().bind<bool>(error).isBound());
+
+            for (auto path : {"/test/test/integer_array", "/test/test/string",
+                              "/test/test/bit_block/one", "/test/test/parameter_block"}) {
+                CAPTURE(path);
+                ElementHandle handle{*this, path};
+                CHECK_FALSE(handle.getWrapped().bind<uint32_t>(error).isBound());
+                CHECK_FALSE(error.empty());
+            }
+        }
+        THEN ("An unbound accessor fails") {
+            BoundParameter<uint32_t> unbound;
+            uint32_t value;
+            CHECK_FALSE(unbound.isBound());
+            CHECK_FALSE(unbound.get(value));
+            CHECK_FALSE(unbound.set(50));
+        }
+    }
+}
+
+SCENARIO_METHOD(AllParamsPF, "Array views", "[handler][array view]")
+{
+    GIVEN ("Array parameters of known values") {
+        ElementHandle integers{*this, "/test/test/integer_array"};
+        ElementHandle fixedPoints{*this, "/test/test/fix_point_array"};
+        ElementHandle booleans{*this, "/test/test/bool_array"};
+        string error;
+        REQUIRE_NOTHROW(integers.setAsSignedIntegerArray({1, -2, 3, -4}));
+        REQUIRE(fixedPoints.getWrapped().setAsDoubleArray({0.5, -1.25, 2}, error));
+        REQUIRE(booleans.getWrapped().setAsBooleanArray({true, false}, error));
+
+        THEN ("Read views give the array content without copy") {
+            ParameterArrayView view = integers.getWrapped().getArrayView(error);
+            CAPTURE(error);
+            REQUIRE(view.isValid());
+            CHECK(view.getLength() == 4);
+            CHECK(view.getStride() == 4);
+            auto *data = static_cast<const int32_t *>(view.getData());
+            CHECK((std::vector<int32_t>(data, data + 4)) == (std::vector<int32_t>{1, -2, 3, -4}));
+        }
+        THEN ("Read views convert all elements at once") {
+            std::vector<int32_t> signedValues(4);
+            REQUIRE(integers.getWrapped().getArrayView(error).getAsSignedIntegers(
+                signedValues.data()));
+            CHECK(signedValues == (std::vector<int32_t>{1, -2, 3, -4}));
+
+            std::vector<double> doubleValues(3);
+            REQUIRE(fixedPoints.getWrapped().getArrayView(error).getAsDoubles(
+                doubleValues.data()));
+            CHECK(doubleValues == (std::vector<double>{0.5, -1.25, 2}));
+
+            std::vector<uint32_t> booleanValues(2);
+            ParameterArrayView view = booleans.getWrapped().getArrayView(error);
+            REQUIRE(view.getAsIntegers(booleanValues.data()));
+            CHECK(booleanValues == (std::vector<uint32_t>{1, 0}));
+            CHECK_FALSE(view.getAsDoubles(doubleValues.data()));
+            CHECK_FALSE(view.getAsSignedIntegers(signedValues.data()));
+        }
+        WHEN ("Writing integers through a writable view") {
+            {
+                WritableParameterArrayView view = integers.getWrapped().getWritableArrayView(error);
+                CAPTURE(error);
+                REQUIRE(view.isValid());
+                auto *data = static_cast<int32_t *>(view.getData());
+                data[1] = 5;
+                data[3] = -6;
+                REQUIRE(view.commit(error));
+                CHECK_FALSE(view.isValid());
+            }
+            {
+                // Committed on destruction
+                WritableParameterArrayView view = integers.getWrapped().getWritableArrayView(error);
+                REQUIRE(view.isValid());
+                static_cast<int32_t *>(view.getData())[0] = 7;
+            }
+            THEN ("The written values are read back") {
+                std::vector<int32_t> values;
+                REQUIRE_NOTHROW(integers.getAsSignedIntegerArray(values));
+                CHECK(values == (std::vector<int32_t>{7, 5, 3, -6}));
+            }
+        }
+        THEN ("Only integer arrays can be written through a view") {
+            CHECK_FALSE(fixedPoints.getWrapped().getWritableArrayView(error).isValid());
+            CHECK(error.find("not integers") != string::npos);
+            CHECK_FALSE(booleans.getWrapped().getWritableArrayView(error).isValid());
+        }
+        THEN ("Arrays can not be written through a view in tuning mode") {
+            REQUIRE_NOTHROW(setTuningMode(true));
+            CHECK_FALSE(integers.getWrapped().getWritableArrayView(error).isValid());
+            CHECK(error.find("tuning mode") != string::npos);
+        }
+    }
+    GIVEN ("Elements that can not be viewed") {
+        string error;
+        for (auto path : {"/test/test/integer", "/test/test/enum_array", "/test/test/string",
+                          "/test/test/parameter_block"}) {
+            CAPTURE(path);
+            ElementHandle handle{*this, path};
+            CHECK_FALSE(handle.getWrapped().getArrayView(error).isValid());
+            CHECK_FALSE(error.empty());
+            CHECK_FALSE(handle.getWrapped().getWritableArrayView(error).isValid());
+        }
+        ParameterArrayView invalid;
+        CHECK(invalid.getData() == nullptr);
+        CHECK(invalid.getLength() == 0);
+        CHECK(invalid.getStride() == 0);
+    }
+}
+SCENARIO_METHOD(CriterionPF, "Snapshot reads", "[handler][thread]")
+{
+    GIVEN ("A started parameter framework") {
+        REQUIRE_NOTHROW(start());
+        ElementHandle handle{*this, "/test/test/modeParam"};
+
+        WHEN ("Parameters are read while configurations are applied") {
+            std::atomic<bool> stop{false};
+            std::atomic<bool> inconsistent{false};
+            std::thread reader([&] {
+                while (not stop) {
+                    uint32_t value;
+                    handle.getAsInteger(value);
+                    if (value != 1 and value != 2) {
+                        inconsistent = true;
+                    }
+                }
+            });
+            for (int state : {1, 0, 1, 0, 1}) {
+                setCriterion("Mode", state);
+                applyConfigurations();
+                uint32_t value;
+                handle.getAsInteger(value);
+                CHECK(value == (state ? 2u : 1u));
+            }
+            stop = true;
+            reader.join();
+            THEN ("Readers only see applied values") {
+                CHECK(not inconsistent);
+                CHECK(get("/test/test/modeParam") == "2");
+            }
+        }
+        WHEN ("A rogue parameter is set through its handle") {
+            ElementHandle rogueHandle{*this, "/test/test/gainParam"};
+            rogueHandle.setAsInteger(7);
+            THEN ("It is read back") {
+                uint32_t value;
+                rogueHandle.getAsInteger(value);
+                CHECK(value == 7);
+                CHECK(get("/test/test/gainParam") == "7");
+            }
+        }
+        WHEN ("A rogue parameter is set several times between reads") {
+            ElementHandle rogueHandle{*this, "/test/test/gainParam"};
+            uint32_t value;
+            rogueHandle.setAsInteger(3);
+            rogueHandle.getAsInteger(value);
+            CHECK(value == 3);
+            rogueHandle.setAsInteger(4);
+            rogueHandle.setAsInteger(5);
+            THEN ("The last value is read back") {
+                rogueHandle.getAsInteger(value);
+                CHECK(value == 5);
+                rogueHandle.getAsInteger(value);
+                CHECK(value == 5);
+            }
+        }
+    }
+}
+
+SCENARIO_METHOD(CriterionPF, "Lock sharding", "[handler][thread]")
+{
+    GIVEN ("A parameter framework locking parameter accesses per subsystem") {
+        REQUIRE_NOTHROW(setLockSharding(true));
+        CHECK(isLockShardingEnabled());
+        REQUIRE_NOTHROW(start());
+
+        THEN ("Lock sharding can not be changed while started") {
+            CHECK_THROWS_AS(setLockSharding(false), Exception);
+        }
+        WHEN ("Parameters are accessed while configurations are applied") {
+            ElementHandle handle{*this, "/test/test/modeParam"};
+            ElementHandle rogueHandle{*this, "/test/test/gainParam"};
+            std::atomic<bool> stop{false};
+            std::atomic<bool> inconsistent{false};
+            std::thread accessor([&] {
+                for (uint32_t written = 0; not stop; written = (written + 1) % 100) {
+                    uint32_t value;
+                    handle.getAsInteger(value);
+                    if (value != 1 and value != 2) {
+                        inconsistent = true;
+                    }
+                    rogueHandle.setAsInteger(written);
+                    rogueHandle.getAsInteger(value);
+                    if (value != written) {
+                        inconsistent = true;
+                    }
+                }
+            });
+            for (int state : {1, 0, 1}) {
+                setCriterion("Mode", state);
+                applyConfigurations();
+                CHECK(get("/test/test/modeParam") == (state ? "2" : "1"));
+            }
+            stop = true;
+            accessor.join();
+            THEN ("Accesses are consistent") {
+                CHECK(not inconsistent);
+            }
+        }
+    }
+}
+
 } // namespace parameterFramework
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "Config.hpp"
+#include "ParameterFramework.hpp"
+#include "TmpFile.hpp"
+#include <catch.hpp>
+#include <string>
+
+using std::string;
+
+namespace parameterFramework
+{
+
+namespace
+{
+
+const size_t gConfigurationCount = 4;
+
+/** Parameter framework whose domain has a configuration per state of the Mode criterion. */
+struct LazySettingsPF : public ParameterFramework
+{
+    LazySettingsPF(const Config &config) : ParameterFramework{config}
+    {
+        string error;
+
+        auto mode = createSelectionCriterionType(false);
+        for (size_t index = 0; index < gConfigurationCount; ++index) {
+            REQUIRE(mode->addValuePair(static_cast<int>(index), "m" + std::to_string(index),
+                                       error));
+        }
+        REQUIRE(createSelectionCriterion("Mode", mode) != nullptr);
+    }
+
+    string get(const string &path)
+    {
+        string value;
+        getParameter(path, value);
+        return value;
+    }
+
+    string getInConfiguration(const string &configuration, const string &path)
+    {
+        string value;
+        getConfigurationParameter("Domain", configuration, path, value);
+        return value;
+    }
+
+    void applyMode(size_t index)
+    {
+        getSelectionCriterion("Mode")->setCriterionState(static_cast<int>(index));
+        applyConfigurations();
+    }
+
+    /** @return a configuration of the domain, with the given extra configuration */
+    static Config createConfig(const string &frameworkAttributes,
+                               const string &extraConfiguration = "",
+                               const string &extraSettings = "")
+    {
+        string configurations;
+        string settings;
+
+        for (size_t index = 0; index < gConfigurationCount; ++index) {
+
+            string name = "m" + std::to_string(index);
+
+            configurations += "<Configuration Name='" + name +
+                              "'><CompoundRule Type='All'><SelectionCriterionRule"
+                              " SelectionCriterion='Mode' MatchesWhen='Is' Value='" +
+                              name + "'/></CompoundRule></Configuration>";
+            settings += "<Configuration Name='" + name +
+                        "'><ConfigurableElement Path='/test/test/block'><ParameterBlock"
+                        " Name='block'><IntegerParameter Name='first'>" +
+                        std::to_string(10 * index) + "</IntegerParameter><IntegerParameter"
+                        " Name='second'>" +
+                        std::to_string(10 * index + 1) +
+                        "</IntegerParameter></ParameterBlock></ConfigurableElement>"
+                        "</Configuration>";
+        }
+        Config config;
+        config.frameworkAttributes = frameworkAttributes;
+        config.instances = R"(<ParameterBlock Name="block">
+                                  <IntegerParameter Name="first" Size="16"/>
+                                  <IntegerParameter Name="second" Size="16"/>
+                              </ParameterBlock>)";
+        config.domains = "<ConfigurableDomain Name='Domain'><Configurations>" + configurations +
+                         extraConfiguration + "</Configurations><ConfigurableElements>"
+                                              "<ConfigurableElement Path='/test/test/block'/>"
+                                              "</ConfigurableElements><Settings>" +
+                         settings + extraSettings + "</Settings></ConfigurableDomain>";
+        return config;
+    }
+};
+
+const char *const gLazyAttributes = "LazySettings='true' LazySettingsCacheSize='2'";
+
+/** Check each configuration is applied with its settings, twice so that evicted settings are
+ * decoded again. */
+void checkApplications(LazySettingsPF &pf)
+{
+    for (size_t round = 0; round < 2; ++round) {
+        for (size_t index = 0; index < gConfigurationCount; ++index) {
+            pf.applyMode(index);
+            CHECK(pf.get("/test/test/block/first") == std::to_string(10 * index));
+            CHECK(pf.get("/test/test/block/second") == std::to_string(10 * index + 1));
+        }
+    }
+}
+
+} // namespace
+
+SCENARIO("Lazy settings", "[lazy settings]")
+{
+    GIVEN ("A bundle compiled from the domains of a parameter framework without lazy settings") {
+        LazySettingsPF eager(LazySettingsPF::createConfig(""));
+        REQUIRE_NOTHROW(eager.start());
+
+        utility::TmpFile bundle("");
+        REQUIRE_NOTHROW(eager.exportDomainsBundle(bundle.getPath()));
+
+        Config config = LazySettingsPF::createConfig(gLazyAttributes);
+        config.domains = "";
+        config.domainsBundle = bundle.getPath();
+
+        WHEN ("Starting with lazy settings from the bundle") {
+            LazySettingsPF lazy(config);
+            REQUIRE_NOTHROW(lazy.start());
+
+            THEN ("Settings are decoded when exported") {
+                CHECK(lazy.exportDomainsXml() == eager.exportDomainsXml());
+            }
+            THEN ("Settings are decoded when applied") {
+                checkApplications(lazy);
+            }
+            AND_WHEN ("A configuration is tuned, then evicted by the application of the others") {
+                REQUIRE_NOTHROW(lazy.setTuningMode(true));
+                string value = "1000";
+                REQUIRE_NOTHROW(lazy.setConfigurationParameter("Domain", "m1",
+                                                               "/test/test/block/first", value));
+                REQUIRE_NOTHROW(lazy.setTuningMode(false));
+
+                for (size_t index = 0; index < gConfigurationCount; ++index) {
+                    lazy.applyMode(index);
+                }
+                THEN ("The tuned settings are kept") {
+                    CHECK(lazy.getInConfiguration("m1", "/test/test/block/first") == "1000");
+                    CHECK(lazy.getInConfiguration("m1", "/test/test/block/second") == "11");
+                    lazy.applyMode(1);
+                    CHECK(lazy.get("/test/test/block/first") == "1000");
+                }
+            }
+        }
+    }
+    GIVEN ("XML domains with a configuration never applied, with an invalid value") {
+        Config config = LazySettingsPF::createConfig(
+            gLazyAttributes, "<Configuration Name='never'><CompoundRule Type='Any'/>"
+                             "</Configuration>",
+            "<Configuration Name='never'><ConfigurableElement Path='/test/test/block'>"
+            "<ParameterBlock Name='block'><IntegerParameter Name='first'>invalid"
+            "</IntegerParameter><IntegerParameter Name='second'>0</IntegerParameter>"
+            "</ParameterBlock></ConfigurableElement></Configuration>");
+
+        THEN ("Starting fails with lazy settings, XML settings being decoded when loaded") {
+            LazySettingsPF lazy(config);
+            REQUIRE_THROWS_AS(lazy.start(), Exception);
+        }
+    }
+}
+
+} // namespace parameterFramework
@@ -138,6 +138,26 @@ SCENARIO_METHOD(LinearsPF, "Linear points", "[Linear Type]")
                     }
                 }
             }
+
+            AND_THEN ("Set/Get through a bound double accessor") {
+                ElementHandle handle{*this, path};
+                REQUIRE_NOTHROW(setTuningMode(false));
+                string error;
+                auto bound = handle.getWrapped().bind<double>(error);
+                CAPTURE(error);
+                REQUIRE(bound.isBound());
+
+                for (double value : {3000.0, -14400.0, 0.0, 120.0}) {
+                    CHECK(bound.set(value));
+                    double getValueBack = 1.0;
+                    REQUIRE(bound.get(getValueBack));
+                    CHECK(getValueBack == value);
+                    REQUIRE_NOTHROW(handle.getAsDouble(getValueBack));
+                    CHECK(getValueBack == value);
+                }
+                CHECK_FALSE(bound.set(3010.0));
+                CHECK_FALSE(bound.set(-14410.0));
+            }
         }
     }
 }
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "TmpFile.hpp"
+#include <ParameterMgrFullConnector.h>
+#include <catch.hpp>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using std::string;
+
+namespace parameterFramework
+{
+
+namespace
+{
+
+const size_t gSubsystemCount = 8;
+
+/** Files of a structure made of included subsystems, which XInclude their components, and
+ * of settings made of XIncluded domains.
+ */
+struct LoadedFiles
+{
+    LoadedFiles()
+        : components("<?xml version='1.0' encoding='UTF-8'?><ComponentTypeSet>"
+                     "<ComponentType Name='Block'>"
+                     "<IntegerParameter Name='integer' Size='16' Min='-3' Max='1000'"
+                     " Signed='true'/></ComponentType></ComponentTypeSet>")
+    {
+        string subsystemIncludes;
+        string domainIncludes;
+
+        for (size_t index = 0; index < gSubsystemCount; ++index) {
+
+            string name = "s" + std::to_string(index);
+            string path = "/test/" + name + "/block/integer";
+
+            subsystems.emplace_back(new utility::TmpFile(
+                "<?xml version='1.0' encoding='UTF-8'?><Subsystem Name='" + name +
+                "' Type='Virtual' Mapping='' xmlns:xi='http://www.w3.org/2001/XInclude'>"
+                "<ComponentLibrary><xi:include href='" + components.getPath() +
+                "'/></ComponentLibrary><InstanceDefinition>"
+                "<Component Name='block' Type='Block'/></InstanceDefinition></Subsystem>"));
+            subsystemIncludes += "<SubsystemInclude Path='" + subsystems.back()->getPath() + "'/>";
+
+            domains.emplace_back(new utility::TmpFile(
+                "<?xml version='1.0' encoding='UTF-8'?><ConfigurableDomain Name='d" +
+                std::to_string(index) + "'><Configurations><Configuration Name='all'>"
+                "<CompoundRule Type='All'/></Configuration></Configurations>"
+                "<ConfigurableElements><ConfigurableElement Path='" + path +
+                "'/></ConfigurableElements><Settings><Configuration Name='all'>"
+                "<ConfigurableElement Path='" + path + "'><IntegerParameter Name='integer'>" +
+                std::to_string(index) + "</IntegerParameter></ConfigurableElement>"
+                "</Configuration></Settings></ConfigurableDomain>"));
+            domainIncludes += "<xi:include href='" + domains.back()->getPath() + "'/>";
+        }
+        structure.reset(new utility::TmpFile("<?xml version='1.0' encoding='UTF-8'?>"
+                                             "<SystemClass Name='test'>" +
+                                             subsystemIncludes + "</SystemClass>"));
+        settings.reset(new utility::TmpFile(
+            "<?xml version='1.0' encoding='UTF-8'?><ConfigurableDomains SystemClassName='test'"
+            " xmlns:xi='http://www.w3.org/2001/XInclude'>" + domainIncludes +
+            "</ConfigurableDomains>"));
+        config.reset(new utility::TmpFile(
+            "<?xml version='1.0' encoding='UTF-8'?>"
+            "<ParameterFrameworkConfiguration SystemClassName='test' TuningAllowed='true'"
+            " ServerPort='1'><SubsystemPlugins/><StructureDescriptionFileLocation Path='" +
+            structure->getPath() + "'/><SettingsConfiguration><ConfigurableDomainsFileLocation"
+            " Path='" + settings->getPath() + "'/></SettingsConfiguration>"
+            "</ParameterFrameworkConfiguration>"));
+    }
+
+    utility::TmpFile components;
+    std::vector<std::unique_ptr<utility::TmpFile>> subsystems;
+    std::vector<std::unique_ptr<utility::TmpFile>> domains;
+    std::unique_ptr<utility::TmpFile> structure;
+    std::unique_ptr<utility::TmpFile> settings;
+    std::unique_ptr<utility::TmpFile> config;
+};
+
+/** Parameter framework started with a given number of loading threads. */
+class LoadingPF : private CParameterMgrFullConnector::ILogger
+{
+public:
+    LoadingPF(const string &configPath, size_t loadThreadCount) : mConnector(configPath)
+    {
+        mConnector.setLogger(this);
+        mConnector.setForceNoRemoteInterface(true);
+        mConnector.setFailureOnFailedSettingsLoad(true);
+
+        string error;
+        REQUIRE(mConnector.setLoadThreadCount(loadThreadCount, error));
+        CHECK(mConnector.getLoadThreadCount() == loadThreadCount);
+    }
+
+    bool start(string &error) { return mConnector.start(error); }
+
+    bool logged(const string &message) const
+    {
+        for (const auto &log : mLogs) {
+            if (log.find(message) != string::npos) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    string command(const string &name, const std::vector<string> &arguments = {})
+    {
+        std::unique_ptr<CommandHandlerInterface> commandHandler(mConnector.createCommandHandler());
+        string output;
+        REQUIRE(commandHandler->process(name, arguments, output));
+        return output;
+    }
+
+private:
+    void info(const string &log) override { mLogs.push_back(log); }
+    void warning(const string &log) override { mLogs.push_back(log); }
+
+    CParameterMgrFullConnector mConnector;
+    std::vector<string> mLogs;
+};
+
+} // namespace
+
+SCENARIO("Parallel loading", "[parallel loading]")
+{
+    GIVEN ("A structure and settings made of included files") {
+        LoadedFiles files;
+
+        LoadingPF serial(files.config->getPath(), 1);
+        string error;
+        INFO(error);
+        REQUIRE(serial.start(error));
+
+        LoadingPF parallel(files.config->getPath(), 4);
+        REQUIRE(parallel.start(error));
+
+        THEN ("Files are parsed concurrently into the same structure and settings") {
+            CHECK(parallel.logged("Parsing files with 4 threads"));
+            CHECK(parallel.command("getSystemClassXML") == serial.command("getSystemClassXML"));
+            CHECK(parallel.command("getDomainsWithSettingsXML") ==
+                  serial.command("getDomainsWithSettingsXML"));
+
+            for (size_t index = 0; index < gSubsystemCount; ++index) {
+                string path = "/test/s" + std::to_string(index) + "/block/integer";
+                CHECK(parallel.command("getParameter", {path}) == std::to_string(index));
+            }
+        }
+        THEN ("The parse time of each file is logged") {
+            CHECK(parallel.logged(files.structure->getPath() + ": "));
+            CHECK(parallel.logged(files.components.getPath() + ": "));
+            CHECK(parallel.logged(files.settings->getPath() + ": "));
+            for (size_t index = 0; index < gSubsystemCount; ++index) {
+                CHECK(parallel.logged(files.subsystems[index]->getPath() + ": "));
+                CHECK(parallel.logged(files.domains[index]->getPath() + ": "));
+            }
+        }
+    }
+    GIVEN ("Settings XIncluding a malformed file") {
+        LoadedFiles files;
+        std::ofstream(files.domains.back()->getPath()) << "<ConfigurableDomain Name='broken'>";
+
+        THEN ("Loading fails with the same error, whether files are parsed concurrently or not") {
+            string serialError;
+            LoadingPF serial(files.config->getPath(), 1);
+            REQUIRE_FALSE(serial.start(serialError));
+
+            string parallelError;
+            LoadingPF parallel(files.config->getPath(), 4);
+            REQUIRE_FALSE(parallel.start(parallelError));
+
+            CHECK(parallelError == serialError);
+            CHECK(parallelError.find(files.domains.back()->getPath()) != string::npos);
+            CHECK(parallelError.find("libxml failed to resolve XIncludes") != string::npos);
+        }
+    }
+}
+
+} // namespace parameterFramework
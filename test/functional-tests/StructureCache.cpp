@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "TmpFile.hpp"
+#include <ParameterMgrFullConnector.h>
+#include <catch.hpp>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using std::string;
+
+namespace parameterFramework
+{
+
+/** Files of a structure made of an included subsystem, which XIncludes its components. */
+struct StructureFiles
+{
+    StructureFiles()
+        : components(componentsXml("")),
+          subsystem("<?xml version='1.0' encoding='UTF-8'?>"
+                    "<Subsystem Name='test' Type='Virtual' Mapping=''"
+                    " xmlns:xi='http://www.w3.org/2001/XInclude'>"
+                    "<ComponentLibrary><xi:include href='" +
+                    components.getPath() +
+                    "'/></ComponentLibrary>"
+                    "<InstanceDefinition><Component Name='block' Type='Block'/>"
+                    "</InstanceDefinition></Subsystem>"),
+          structure("<?xml version='1.0' encoding='UTF-8'?><SystemClass Name='test'>"
+                    "<SubsystemInclude Path='" +
+                    subsystem.getPath() + "'/></SystemClass>"),
+          cache(""),
+          config("<?xml version='1.0' encoding='UTF-8'?>"
+                 "<ParameterFrameworkConfiguration SystemClassName='test' TuningAllowed='true'"
+                 " ServerPort='1'><SubsystemPlugins/>"
+                 "<StructureDescriptionFileLocation Path='" +
+                 structure.getPath() + "'/><StructureCacheFileLocation Path='" + cache.getPath() +
+                 "'/></ParameterFrameworkConfiguration>")
+    {
+    }
+
+    static string componentsXml(const string &additionalParameter)
+    {
+        return "<?xml version='1.0' encoding='UTF-8'?><ComponentTypeSet>"
+               "<ComponentType Name='Block'>"
+               "<IntegerParameter Name='integer' Size='16' Min='-3' Max='1000' Signed='true'/>"
+               "<EnumParameter Name='enum' Size='8'><ValuePair Literal='a' Numerical='3'/>"
+               "<ValuePair Literal='b' Numerical='5'/></EnumParameter>" +
+               additionalParameter + "</ComponentType></ComponentTypeSet>";
+    }
+
+    utility::TmpFile components;
+    utility::TmpFile subsystem;
+    utility::TmpFile structure;
+    utility::TmpFile cache;
+    utility::TmpFile config;
+};
+
+/** Parameter framework recording the logs of its start. */
+class LoggedPF : private CParameterMgrFullConnector::ILogger
+{
+public:
+    LoggedPF(const string &configPath) : mConnector(configPath)
+    {
+        mConnector.setLogger(this);
+        mConnector.setForceNoRemoteInterface(true);
+    }
+
+    void start()
+    {
+        string error;
+        INFO(error);
+        REQUIRE(mConnector.start(error));
+    }
+
+    bool logged(const string &message) const
+    {
+        for (const auto &log : mLogs) {
+            if (log.find(message) != string::npos) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    string getStructure()
+    {
+        std::unique_ptr<CommandHandlerInterface> commandHandler(mConnector.createCommandHandler());
+        string structure;
+        REQUIRE(commandHandler->process("getSystemClassXML", {}, structure));
+        return structure;
+    }
+
+private:
+    void info(const string &log) override { mLogs.push_back(log); }
+    void warning(const string &log) override { mLogs.push_back(log); }
+
+    CParameterMgrFullConnector mConnector;
+    std::vector<string> mLogs;
+};
+
+SCENARIO("Structure cache", "[structure cache]")
+{
+    GIVEN ("A structure made of included files and an invalid structure cache") {
+        StructureFiles files;
+
+        LoggedPF first(files.config.getPath());
+        REQUIRE_NOTHROW(first.start());
+
+        THEN ("The structure is parsed and the cache rebuilt") {
+            CHECK(first.logged("not used: Not a structure cache"));
+            CHECK(std::ifstream(files.cache.getPath()).peek() == 'P');
+        }
+        WHEN ("Starting again") {
+            LoggedPF second(files.config.getPath());
+            REQUIRE_NOTHROW(second.start());
+
+            THEN ("The structure is read from the cache") {
+                CHECK(second.logged("read from cache"));
+                CHECK(second.getStructure() == first.getStructure());
+            }
+        }
+        WHEN ("An XIncluded file changes") {
+            std::ofstream(files.components.getPath())
+                << StructureFiles::componentsXml("<BooleanParameter Name='added'/>");
+
+            LoggedPF changed(files.config.getPath());
+            REQUIRE_NOTHROW(changed.start());
+
+            THEN ("The cache is out of date and rebuilt") {
+                CHECK(changed.logged("not used: Structure description files changed"));
+                CHECK(changed.getStructure().find("added") != string::npos);
+
+                LoggedPF rebuilt(files.config.getPath());
+                REQUIRE_NOTHROW(rebuilt.start());
+                CHECK(rebuilt.logged("read from cache"));
+                CHECK(rebuilt.getStructure() == changed.getStructure());
+            }
+        }
+    }
+}
+
+} // namespace parameterFramework
@@ -61,6 +61,8 @@ struct Config
     std::string instances;
     /** Content of the configuartion ConfigurableDomains xml node. */
     std::string domains;
+    /** Path of the compiled domains bundle to load instead of the domains, none if empty. */
+    std::string domainsBundle;
     /** Content of the configuration SubsystemPlugins xml node. */
     std::string components;
 
@@ -75,6 +77,9 @@ struct Config
     using Plugins = Plugin::Collection;
     Plugins plugins;
 
+    /** Additional attributes of the configuration ParameterFrameworkConfiguration xml node. */
+    std::string frameworkAttributes;
+
     /** Subsystem type. Virtual by default. */
     std::string subsystemType = "Virtual";
 };
@@ -51,6 +51,8 @@ public:
           mDomainsFile(format(mDomainsTemplate, {{"domains", config.domains}})),
           mConfigFile(format(mConfigTemplate, {{"structurePath", mStructureFile.getPath()},
                                                {"domainsPath", mDomainsFile.getPath()},
+                                               {"domainsBundle", toXml(config.domainsBundle)},
+                                               {"frameworkAttributes", config.frameworkAttributes},
                                                {"plugins", toXml(config.plugins)}}))
     {
     }
@@ -58,6 +60,14 @@ public:
     std::string getPath() { return mConfigFile.getPath(); }
 
 private:
+    std::string toXml(const std::string &domainsBundle)
+    {
+        if (domainsBundle.empty()) {
+            return "";
+        }
+        return "<ConfigurableDomainsBundleFileLocation Path='" + domainsBundle + "'/>";
+    }
+
     std::string toXml(const Config::Plugin::Collection &plugins)
     {
         std::string pluginsXml;
@@ -91,13 +101,15 @@ private:
     }
 
     const char *mConfigTemplate = R"(<?xml version='1.0' encoding='UTF-8'?>
-        <ParameterFrameworkConfiguration SystemClassName='test' TuningAllowed='true'>
+        <ParameterFrameworkConfiguration SystemClassName='test' TuningAllowed='true'
+                                         {frameworkAttributes}>
             <SubsystemPlugins>
                 {plugins}
             </SubsystemPlugins>
             <StructureDescriptionFileLocation Path='{structurePath}'/>
             <SettingsConfiguration>
                 <ConfigurableDomainsFileLocation Path='{domainsPath}'/>
+                {domainsBundle}
             </SettingsConfiguration>
         </ParameterFrameworkConfiguration>
      )";
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "Config.hpp"
+#include "ParameterFramework.hpp"
+
+#include <catch.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace parameterFramework
+{
+
+/** Parameter framework with two domains, each one selected by its own criterion. */
+struct CriterionPF : public ParameterFramework
+{
+    CriterionPF() : ParameterFramework{createConfig()}
+    {
+        for (auto &name : {"Mode", "Other"}) {
+            auto type = createSelectionCriterionType(false);
+            std::string error;
+            REQUIRE(type->addValuePair(0, "off", error));
+            REQUIRE(type->addValuePair(1, "on", error));
+            REQUIRE(createSelectionCriterion(name, type) != nullptr);
+        }
+    }
+
+    void setCriterion(const std::string &name, int state)
+    {
+        getSelectionCriterion(name)->setCriterionState(state);
+    }
+
+    std::string get(const std::string &path)
+    {
+        std::string value;
+        getParameter(path, value);
+        return value;
+    }
+
+    /** Process a remote command, checking that it succeeds
+     *
+     * @return the command output
+     */
+    std::string command(const std::string &name, const std::vector<std::string> &arguments = {})
+    {
+        std::unique_ptr<CommandHandlerInterface> commandHandler(createCommandHandler());
+        std::string output;
+        CAPTURE(name);
+        CHECK(commandHandler->process(name, arguments, output));
+        return output;
+    }
+
+private:
+    static std::string domain(const std::string &name, const std::string &criterion,
+                              const std::string &param, const std::string &offValue,
+                              const std::string &onValue)
+    {
+        auto configuration = [&](const std::string &state) {
+            return "<Configuration Name='" + state +
+                   "'><CompoundRule Type='All'>"
+                   "<SelectionCriterionRule SelectionCriterion='" +
+                   criterion + "' MatchesWhen='Is' Value='" + state +
+                   "'/></CompoundRule></Configuration>";
+        };
+        auto settings = [&](const std::string &state, const std::string &value) {
+            return "<Configuration Name='" + state + "'><ConfigurableElement Path='/test/test/" +
+                   param + "'><IntegerParameter Name='" + param + "'>" + value +
+                   "</IntegerParameter></ConfigurableElement></Configuration>";
+        };
+        return "<ConfigurableDomain Name='" + name + "'><Configurations>" + configuration("off") +
+               configuration("on") +
+               "</Configurations><ConfigurableElements><ConfigurableElement Path='/test/test/" +
+               param + "'/></ConfigurableElements><Settings>" + settings("off", offValue) +
+               settings("on", onValue) + "</Settings></ConfigurableDomain>";
+    }
+
+    static Config createConfig()
+    {
+        Config config;
+        config.instances = R"(<IntegerParameter Name="modeParam" Size="8"/>
+                              <IntegerParameter Name="otherParam" Size="8"/>
+                              <IntegerParameter Name="gainParam" Size="8"/>
+                              <IntegerParameter Name="volumeParam" Size="8"/>)";
+        config.domains = domain("ModeDomain", "Mode", "modeParam", "1", "2") +
+                         domain("OtherDomain", "Other", "otherParam", "10", "20");
+        return config;
+    }
+};
+
+} // namespace parameterFramework
@@ -101,6 +101,9 @@ public:
         mayFailCall(&EH::getAsSignedIntegerArray, value);
     }
 
+    void setAsString(const std::string &value) { mayFailCall(&EH::setAsString, value); }
+    void getAsString(std::string &value) const { mayFailCall(&EH::getAsString, value); }
+
     std::string getStructureAsXML() const { return mayFailGet(&EH::getStructureAsXML); }
 
     std::string getAsXML() const { return mayFailGet(&EH::getAsXML); }
@@ -113,6 +116,10 @@ public:
         return settings;
     }
     void setAsBytes(const std::vector<uint8_t> &settings) { mayFailSet(&EH::setAsBytes, settings); }
+
+    /** @return the wrapped handle, e.g. to queue writes to a ParameterTransaction. */
+    const EH &getWrapped() const { return *this; }
+    EH &getWrapped() { return *this; }
 };
 
 } // namespace parameterFramework
@@ -75,8 +75,22 @@ public:
      * can not fail (no failure to throw).
      * @{ */
     using PF::applyConfigurations;
+    using PF::applyConfigurationsAsync;
+    using PF::applyCriteriaTransaction;
+    using PF::setApplyStatisticsEnabled;
+    using PF::isApplyStatisticsEnabled;
+    using PF::getApplyStatistics;
+    using PF::resetApplyStatistics;
+    using PF::getStartupProfile;
+    using PF::createSelectionCriterionType;
+    using PF::createSelectionCriterion;
+    using PF::getSelectionCriterion;
     using PF::getFailureOnMissingSubsystem;
     using PF::getFailureOnFailedSettingsLoad;
+    using PF::getApplyThreadCount;
+    using PF::getSyncThreadCount;
+    using PF::getLoadThreadCount;
+    using PF::isLockShardingEnabled;
     using PF::getForceNoRemoteInterface;
     using PF::setForceNoRemoteInterface;
     using PF::getSchemaUri;
@@ -88,6 +102,7 @@ public:
     using PF::isAutoSyncOn;
     using PF::setLogger;
     using PF::createCommandHandler;
+    using PF::createParameterTransaction;
     /** @} */
 
     /** Wrap PF::setValidateSchemasOnStart to throw an exception on failure. */
@@ -108,6 +123,27 @@ public:
         mayFailCall(&PPF::setFailureOnMissingSubsystem, fail);
     }
 
+    /** Wrap PF::setApplyThreadCount to throw an exception on failure. */
+    void setApplyThreadCount(size_t threadCount)
+    {
+        mayFailCall(&PPF::setApplyThreadCount, threadCount);
+    }
+
+    /** Wrap PF::setSyncThreadCount to throw an exception on failure. */
+    void setSyncThreadCount(size_t threadCount)
+    {
+        mayFailCall(&PPF::setSyncThreadCount, threadCount);
+    }
+
+    /** Wrap PF::setLoadThreadCount to throw an exception on failure. */
+    void setLoadThreadCount(size_t threadCount)
+    {
+        mayFailCall(&PPF::setLoadThreadCount, threadCount);
+    }
+
+    /** Wrap PF::setLockSharding to throw an exception on failure. */
+    void setLockSharding(bool enabled) { mayFailCall(&PPF::setLockSharding, enabled); }
+
     /** Renaming for better readability (and coherency with PF::isValueSpaceRaw)
      *  of PF::setValueSpace. */
     void setRawValueSpace(bool enable) { setValueSpace(enable); }
@@ -122,6 +158,9 @@ public:
     /** Wrap PF::setAutoSync to throw an exception on failure. */
     void setAutoSync(bool enable) { mayFailCall(&PF::setAutoSync, enable); }
 
+    /** Wrap PF::sync to throw an exception on failure. */
+    void sync() { mayFailCall(&PF::sync); }
+
     /** Wrap PF::accessParameterValue in "set" mode (and rename it) to throw an
      * exception on failure
      */
@@ -155,6 +194,23 @@ public:
         mayFailCall(&PF::accessConfigurationValue, domain, configuration, path, value, false);
     }
 
+    /** Wrap PF::exportDomainsXml to throw an exception on failure.
+     *
+     * @return the domains, with their settings
+     */
+    std::string exportDomainsXml()
+    {
+        std::string xml;
+        mayFailCall(&PF::exportDomainsXml, xml, true, false);
+        return xml;
+    }
+
+    /** Wrap PF::exportDomainsBundle to throw an exception on failure. */
+    void exportDomainsBundle(const std::string &path)
+    {
+        mayFailCall(&PF::exportDomainsBundle, path);
+    }
+
 private:
     /** Create an unwrapped element handle.
      *
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <ParameterMgrFullConnector.h>
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+using std::string;
+
+class Logger final : public CParameterMgrFullConnector::ILogger
+{
+public:
+    void info(const std::string &log) override { std::cerr << "Info: " << log << std::endl; }
+
+    void warning(const std::string &log) override { std::cerr << "Warning: " << log << std::endl; }
+};
+
+class DomainsBundleCompiler
+{
+public:
+    using Exception = std::runtime_error;
+
+    DomainsBundleCompiler(const string &toplevelConfig, bool verbose) : mConnector(toplevelConfig)
+    {
+        if (verbose) {
+            mLogger.reset(new Logger);
+            mConnector.setLogger(mLogger.get());
+        }
+
+        // The settings are the point of the compilation, do not silently drop them
+        mConnector.setFailureOnMissingSubsystem(false);
+        mConnector.setFailureOnFailedSettingsLoad(true);
+
+        // Disable the remote interface because we don't need it and it might
+        // get in the way (e.g. the port is already in use)
+        mConnector.setForceNoRemoteInterface(true);
+    }
+
+    /** Create the criteria described in a criteria file
+     *
+     * The file defines one criterion per line, in the domainGenerator.py format:
+     *
+     *     <type> <name> : <values>
+     *
+     * Where <type> is 'InclusiveCriterion' or 'ExclusiveCriterion'.
+     *
+     * @param[in] input The input stream to read from
+     */
+    void addCriteria(std::istream &input);
+
+    /** Start the Parameter Framework, hence load the domains XML file */
+    void start();
+
+    /** Compile the loaded domains
+     *
+     * @param[in] bundlePath the path of the bundle file to write
+     */
+    void compile(const string &bundlePath);
+
+private:
+    void addCriterion(bool inclusive, const string &name, const std::vector<string> &values);
+
+    CParameterMgrFullConnector mConnector;
+    std::unique_ptr<Logger> mLogger;
+};
+
+void DomainsBundleCompiler::addCriteria(std::istream &input)
+{
+    string line;
+    size_t lineNumber = 0;
+
+    while (std::getline(input, line)) {
+        lineNumber++;
+
+        std::istringstream tokens(line);
+        string type;
+        string name;
+        string separator;
+
+        if (not(tokens >> type)) {
+            // Blank line
+            continue;
+        }
+        if ((type != "InclusiveCriterion" && type != "ExclusiveCriterion") ||
+            not(tokens >> name >> separator) || separator != ":") {
+            throw Exception("Invalid criterion definition at line " +
+                            std::to_string(lineNumber) + ": " + line);
+        }
+        std::vector<string> values;
+        string value;
+        while (tokens >> value) {
+            values.push_back(value);
+        }
+        addCriterion(type == "InclusiveCriterion", name, values);
+    }
+}
+
+void DomainsBundleCompiler::addCriterion(bool inclusive, const string &name,
+                                         const std::vector<string> &values)
+{
+    auto criterionType = mConnector.createSelectionCriterionType(inclusive);
+    if (criterionType == nullptr) {
+        throw Exception("Failed to create criterion type of " + name);
+    }
+
+    int index = 0;
+    for (const auto &literalValue : values) {
+        // inclusive criteria are bitfields
+        int numericalValue = inclusive ? 1 << index : index;
+        string error;
+
+        if (not criterionType->addValuePair(numericalValue, literalValue, error)) {
+            throw Exception("Value '" + literalValue + "' rejected for " + name + ": " + error);
+        }
+        index++;
+    }
+
+    if (mConnector.createSelectionCriterion(name, criterionType) == nullptr) {
+        throw Exception("Failed to create criterion '" + name + "'");
+    }
+}
+
+void DomainsBundleCompiler::start()
+{
+    string error;
+    if (not mConnector.start(error)) {
+        throw Exception("Start failed: " + error);
+    }
+}
+
+void DomainsBundleCompiler::compile(const string &bundlePath)
+{
+    string error;
+    if (not mConnector.exportDomainsBundle(bundlePath, error)) {
+        throw Exception("Compilation failed: " + error);
+    }
+}
+
+static const char *usage =
+    R"(Usage: domainsBundleCompiler <top-level config> <criteria file> <bundle> [verbose]
+
+ <top-level config>  the Parameter Framework configuration, referring to the
+                     structure and to the domains XML file to compile
+ <criteria file>     the criteria referred to by the domains, in the
+                     domainGenerator.py format
+ <bundle>            the path of the domains bundle to write
+ verbose             log the Parameter Framework start
+
+The bundle is only valid for the structure it has been compiled from: the
+Parameter Framework rejects it, and loads the domains XML file if any, as
+soon as the structure changes.)";
+
+int main(int argc, char *argv[])
+{
+    if (argc < 4) {
+        std::cerr << usage << std::endl;
+        return 1;
+    }
+
+    string toplevelConfig = argv[1];
+    string criteriaFile = argv[2];
+    string bundlePath = argv[3];
+    bool verbose = argc > 4 && string(argv[4]) == "verbose";
+
+    try {
+        std::ifstream criteria(criteriaFile);
+        if (not criteria) {
+            throw std::runtime_error("Could not open criteria file " + criteriaFile);
+        }
+
+        DomainsBundleCompiler compiler(toplevelConfig, verbose);
+        compiler.addCriteria(criteria);
+        compiler.start();
+        compiler.compile(bundlePath);
+
+        return 0;
+    } catch (std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace utility
+{
+
+/** Serialization of values to a byte buffer
+ *
+ * Values are written in host byte order: buffers are not meant to be exchanged between
+ * platforms.
+ */
+class BinaryWriter
+{
+public:
+    template <class T>
+    void write(T value)
+    {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                      "Only arithmetic and enum values can be written");
+        writeBytes(&value, sizeof(value));
+    }
+
+    /** Write a string, prefixed by its 32 bits size */
+    void writeString(const std::string &value)
+    {
+        write(static_cast<uint32_t>(value.size()));
+        writeBytes(value.data(), value.size());
+    }
+
+    void writeBytes(const void *data, size_t size)
+    {
+        const auto *bytes = static_cast<const uint8_t *>(data);
+
+        mData.insert(end(mData), bytes, bytes + size);
+    }
+
+    const std::vector<uint8_t> &getData() const { return mData; }
+
+private:
+    std::vector<uint8_t> mData;
+};
+
+/** Deserialization of values written by a BinaryWriter
+ *
+ * Reads fail instead of going past the end of the buffer, so that truncated buffers are
+ * detected.
+ */
+class BinaryReader
+{
+public:
+    /** @param[in] data the buffer, to be kept valid during the reader lifetime */
+    BinaryReader(const uint8_t *data, size_t size) : mData(data), mSize(size) {}
+
+    template <class T>
+    bool read(T &value)
+    {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                      "Only arithmetic and enum values can be read");
+
+        const uint8_t *data = readBytes(sizeof(value));
+
+        if (data == nullptr) {
+
+            return false;
+        }
+        memcpy(&value, data, sizeof(value));
+        return true;
+    }
+
+    bool readString(std::string &value)
+    {
+        uint32_t size;
+
+        if (!read(size)) {
+
+            return false;
+        }
+        const uint8_t *data = readBytes(size);
+
+        if (data == nullptr) {
+
+            return false;
+        }
+        value.assign(reinterpret_cast<const char *>(data), size);
+        return true;
+    }
+
+    /** @return the location of the next size bytes, nullptr if past the end of the buffer */
+    const uint8_t *readBytes(size_t size)
+    {
+        if (size > mSize - mPosition) {
+
+            return nullptr;
+        }
+        const uint8_t *data = mData + mPosition;
+
+        mPosition += size;
+        return data;
+    }
+
+    /** @return true if the whole buffer has been read */
+    bool atEnd() const { return mPosition == mSize; }
+
+private:
+    const uint8_t *mData;
+    size_t mSize;
+    size_t mPosition{0};
+};
+
+} // namespace utility
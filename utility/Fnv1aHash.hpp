@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace utility
+{
+
+/** FNV-1a hash
+ *
+ * Unlike std::hash, the value is stable across platforms and releases, hence can be persisted.
+ */
+class Fnv1aHash
+{
+public:
+    void addBytes(const void *data, size_t size)
+    {
+        const auto *bytes = static_cast<const uint8_t *>(data);
+
+        for (size_t index = 0; index < size; index++) {
+
+            mHash = (mHash ^ bytes[index]) * gPrime;
+        }
+    }
+
+    /** Add an integer, in host byte order */
+    void addInteger(uint64_t value) { addBytes(&value, sizeof(value)); }
+
+    /** Add a string, prefixed by its size so that concatenations of different strings differ */
+    void addString(const std::string &value)
+    {
+        addInteger(value.size());
+        addBytes(value.data(), value.size());
+    }
+
+    uint64_t get() const { return mHash; }
+
+private:
+    static const uint64_t gOffsetBasis = 14695981039346656037ULL;
+    static const uint64_t gPrime = 1099511628211ULL;
+
+    uint64_t mHash{gOffsetBasis};
+};
+
+} // namespace utility
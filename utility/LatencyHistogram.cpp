@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "LatencyHistogram.hpp"
+
+namespace utility
+{
+
+void LatencyHistogram::record(Clock::duration duration)
+{
+    auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    uint64_t value = nanoseconds > 0 ? static_cast<uint64_t>(nanoseconds) : 0;
+
+    // Index of the highest bit set, saturating
+    size_t bucket = 0;
+    while (bucket + 1 < bucketCount && (value >> (bucket + 1)) != 0) {
+        bucket++;
+    }
+    mBuckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    mCount.fetch_add(1, std::memory_order_relaxed);
+    mTotal.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t max = mMax.load(std::memory_order_relaxed);
+    while (value > max && !mMax.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+    }
+}
+
+void LatencyHistogram::reset()
+{
+    for (auto &bucket : mBuckets) {
+        bucket = 0;
+    }
+    mCount = 0;
+    mTotal = 0;
+    mMax = 0;
+}
+
+uint64_t LatencyHistogram::getCount() const
+{
+    return mCount.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::getTotal() const
+{
+    return mTotal.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::getMax() const
+{
+    return mMax.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::getPercentile(double percentile) const
+{
+    uint64_t count = getCount();
+    if (count == 0) {
+        return 0;
+    }
+    // Rank of the percentile, at least the first duration
+    auto rank = static_cast<uint64_t>(percentile / 100 * static_cast<double>(count) + 0.5);
+    if (rank == 0) {
+        rank = 1;
+    }
+    uint64_t seen = 0;
+    for (size_t bucket = 0; bucket < bucketCount; bucket++) {
+        seen += mBuckets[bucket].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            // Do not report more than what was recorded
+            uint64_t upperBound = (uint64_t{2} << bucket) - 1;
+            return upperBound < getMax() ? upperBound : getMax();
+        }
+    }
+    return getMax();
+}
+
+} // namespace utility
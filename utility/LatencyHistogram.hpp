@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "NonCopyable.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace utility
+{
+
+/** Lock-free histogram of durations, with power of two buckets.
+ *
+ * Bucket i counts the durations in [2^i, 2^(i+1)) nanoseconds. Recording may happen from
+ * several threads concurrently, reading gives a consistent view only in the absence of writers.
+ */
+class LatencyHistogram : private NonCopyable
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /** Record a duration */
+    void record(Clock::duration duration);
+
+    /** Forget all recorded durations */
+    void reset();
+
+    /** @return the number of recorded durations */
+    uint64_t getCount() const;
+    /** @return the sum of the recorded durations, in nanoseconds */
+    uint64_t getTotal() const;
+    /** @return the longest recorded duration, in nanoseconds */
+    uint64_t getMax() const;
+
+    /** Upper bound of a percentile of the recorded durations.
+     *
+     * @param[in] percentile in [0, 100]
+     * @return the upper bound of the bucket holding the percentile, in nanoseconds, 0 if empty
+     */
+    uint64_t getPercentile(double percentile) const;
+
+private:
+    static const size_t bucketCount = 48;
+
+    std::array<std::atomic<uint64_t>, bucketCount> mBuckets{};
+    std::atomic<uint64_t> mCount{0};
+    std::atomic<uint64_t> mTotal{0};
+    std::atomic<uint64_t> mMax{0};
+};
+
+/** Record the lifetime of the instance in a histogram, if any */
+class ScopedLatency : private NonCopyable
+{
+public:
+    /** @param[in] histogram where to record, nullptr to record nothing */
+    explicit ScopedLatency(LatencyHistogram *histogram)
+        : mHistogram(histogram),
+          mStart(histogram != nullptr ? LatencyHistogram::Clock::now()
+                                      : LatencyHistogram::Clock::time_point())
+    {
+    }
+    ~ScopedLatency()
+    {
+        if (mHistogram != nullptr) {
+            mHistogram->record(LatencyHistogram::Clock::now() - mStart);
+        }
+    }
+
+private:
+    LatencyHistogram *mHistogram;
+    LatencyHistogram::Clock::time_point mStart;
+};
+
+} // namespace utility
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "ThreadPool.hpp"
+
+namespace utility
+{
+
+ThreadPool::ThreadPool(size_t threadCount)
+{
+    for (size_t worker = 1; worker < threadCount; worker++) {
+
+        mWorkers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStop = true;
+    }
+    mJobCondition.notify_all();
+
+    for (auto &worker : mWorkers) {
+
+        worker.join();
+    }
+}
+
+size_t ThreadPool::getThreadCount() const
+{
+    return mWorkers.size() + 1;
+}
+
+void ThreadPool::parallelFor(size_t count, const std::function<void(size_t)> &task)
+{
+    // Not worth waking workers up
+    if (mWorkers.empty() || count < 2) {
+
+        for (size_t index = 0; index < count; index++) {
+
+            task(index);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> jobLock(mJobMutex);
+
+    // Publish the job
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mTask = &task;
+        mCount = count;
+        mNext = 0;
+        mBusyWorkers = mWorkers.size();
+        mGeneration++;
+    }
+    mJobCondition.notify_all();
+
+    // Take part
+    runTasks(task, count);
+
+    // Wait for workers to be done with it
+    std::unique_lock<std::mutex> lock(mMutex);
+    mDoneCondition.wait(lock, [this] { return mBusyWorkers == 0; });
+    mTask = nullptr;
+}
+
+void ThreadPool::workerLoop()
+{
+    uint64_t generation = 0;
+
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    while (true) {
+
+        mJobCondition.wait(lock, [&] { return mStop || mGeneration != generation; });
+
+        if (mStop) {
+
+            return;
+        }
+        generation = mGeneration;
+        const std::function<void(size_t)> &task = *mTask;
+        size_t count = mCount;
+
+        lock.unlock();
+        runTasks(task, count);
+        lock.lock();
+
+        if (--mBusyWorkers == 0) {
+
+            mDoneCondition.notify_one();
+        }
+    }
+}
+
+void ThreadPool::runTasks(const std::function<void(size_t)> &task, size_t count)
+{
+    for (size_t index = mNext++; index < count; index = mNext++) {
+
+        task(index);
+    }
+}
+
+} // namespace utility
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#pragma once
+
+#include "NonCopyable.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace utility
+{
+
+/** Fixed size pool of worker threads running indexed tasks.
+ *
+ * The calling thread takes part in the work, hence a pool of N threads spawns N - 1 workers.
+ * A pool of 0 or 1 thread runs everything in the calling thread.
+ */
+class ThreadPool : private NonCopyable
+{
+public:
+    /** @param[in] threadCount the number of threads running tasks, including the caller */
+    explicit ThreadPool(size_t threadCount);
+    ~ThreadPool();
+
+    /** @return the number of threads running tasks, including the caller */
+    size_t getThreadCount() const;
+
+    /** Run task(index) for each index in [0, count) and wait for all of them to be done.
+     *
+     * Tasks run concurrently, in no particular order. Calls from several threads are
+     * serialized. The task must not call parallelFor on the same pool.
+     *
+     * @param[in] count the number of tasks
+     * @param[in] task the function to call with each task index
+     */
+    void parallelFor(size_t count, const std::function<void(size_t)> &task);
+
+private:
+    void workerLoop();
+
+    /** Run tasks of the current job until there is no more to pick */
+    void runTasks(const std::function<void(size_t)> &task, size_t count);
+
+    std::vector<std::thread> mWorkers;
+
+    /** Serializes parallelFor callers */
+    std::mutex mJobMutex;
+
+    /** Protects the current job description below */
+    std::mutex mMutex;
+    std::condition_variable mJobCondition;
+    std::condition_variable mDoneCondition;
+
+    const std::function<void(size_t)> *mTask{nullptr};
+    size_t mCount{0};
+    /** Incremented for each job, so that workers take part in each job once */
+    uint64_t mGeneration{0};
+    /** Workers still running the current job */
+    size_t mBusyWorkers{0};
+    bool mStop{false};
+
+    /** Next task index to pick */
+    std::atomic<size_t> mNext{0};
+};
+
+} // namespace utility
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <MappedFile.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+MappedFile::MappedFile(const std::string &path)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+
+    if (fd < 0) {
+
+        throw std::runtime_error(path + ": " + strerror(errno));
+    }
+    struct stat status;
+
+    if (fstat(fd, &status) != 0) {
+
+        int error = errno;
+        close(fd);
+        throw std::runtime_error(path + ": " + strerror(error));
+    }
+    _size = static_cast<size_t>(status.st_size);
+
+    if (_size != 0) {
+
+        void *data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (data == MAP_FAILED) {
+
+            int error = errno;
+            close(fd);
+            throw std::runtime_error(path + ": " + strerror(error));
+        }
+        _data = static_cast<const uint8_t *>(data);
+    }
+    // The mapping stays valid once the file is closed
+    close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (_data != nullptr) {
+
+        munmap(const_cast<uint8_t *>(_data), _size);
+    }
+}
@@ -30,10 +30,17 @@
 
 #include "Utility.h"
 #include "BinaryCopy.hpp"
+#include "ThreadPool.hpp"
+#include "LatencyHistogram.hpp"
+#include "BinaryBuffer.hpp"
+#include "Fnv1aHash.hpp"
+#include "HeapUsage.hpp"
 
 #include <catch.hpp>
+#include <atomic>
 #include <functional>
 #include <map>
+#include <memory>
 
 using std::list;
 using std::string;
@@ -220,4 +227,146 @@ SCENARIO("binaryCopy bit exactness")
     }
 }
 
+SCENARIO("ThreadPool")
+{
+    for (size_t threadCount : {0, 1, 4}) {
+        GIVEN ("A pool of " + std::to_string(threadCount) + " threads") {
+            ThreadPool pool(threadCount);
+
+            THEN ("Every task runs exactly once, job after job") {
+                for (size_t count : {0, 1, 3, 100}) {
+                    CAPTURE(count);
+                    std::vector<std::atomic<int>> runs(count);
+                    for (auto &run : runs) {
+                        run = 0;
+                    }
+                    pool.parallelFor(count, [&](size_t index) { runs[index]++; });
+                    for (auto &run : runs) {
+                        CHECK(run == 1);
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("LatencyHistogram")
+{
+    GIVEN ("An empty histogram") {
+        LatencyHistogram histogram;
+
+        THEN ("Nothing is reported") {
+            CHECK(histogram.getCount() == 0);
+            CHECK(histogram.getMax() == 0);
+            CHECK(histogram.getPercentile(50) == 0);
+        }
+        WHEN ("Recording durations") {
+            using std::chrono::nanoseconds;
+            for (int i = 0; i < 98; i++) {
+                histogram.record(nanoseconds(100));
+            }
+            histogram.record(nanoseconds(1000));
+            histogram.record(nanoseconds(100000));
+
+            THEN ("Percentiles are bounded by their bucket") {
+                CHECK(histogram.getCount() == 100);
+                CHECK(histogram.getTotal() == 98 * 100 + 1000 + 100000);
+                CHECK(histogram.getMax() == 100000);
+                CHECK(histogram.getPercentile(50) == 127);
+                CHECK(histogram.getPercentile(99) == 1023);
+                CHECK(histogram.getPercentile(100) == 100000);
+            }
+            AND_WHEN ("Resetting it") {
+                histogram.reset();
+                THEN ("Nothing is reported anymore") {
+                    CHECK(histogram.getCount() == 0);
+                    CHECK(histogram.getPercentile(99) == 0);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("BinaryWriter and BinaryReader")
+{
+    GIVEN ("Values written to a buffer") {
+        BinaryWriter writer;
+        writer.write(uint8_t{7});
+        writer.write(int32_t{-3});
+        writer.writeString("value");
+        const auto &data = writer.getData();
+
+        WHEN ("Reading them back") {
+            BinaryReader reader(data.data(), data.size());
+            uint8_t byte;
+            int32_t integer;
+            string value;
+            REQUIRE(reader.read(byte));
+            REQUIRE(reader.read(integer));
+            REQUIRE(reader.readString(value));
+
+            THEN ("They are unchanged and the whole buffer is read") {
+                CHECK(byte == 7);
+                CHECK(integer == -3);
+                CHECK(value == "value");
+                CHECK(reader.atEnd());
+            }
+            THEN ("Reading past the end fails") {
+                CHECK_FALSE(reader.read(byte));
+                CHECK(reader.readBytes(1) == nullptr);
+            }
+        }
+        WHEN ("Reading them from a truncated buffer") {
+            BinaryReader reader(data.data(), data.size() - 1);
+            uint8_t byte;
+            int32_t integer;
+            string value;
+            REQUIRE(reader.read(byte));
+            REQUIRE(reader.read(integer));
+
+            THEN ("Reading the truncated string fails") {
+                CHECK_FALSE(reader.readString(value));
+            }
+        }
+    }
+}
+
+SCENARIO("Fnv1aHash")
+{
+    THEN ("Values are the reference FNV-1a ones") {
+        Fnv1aHash empty;
+        CHECK(empty.get() == 14695981039346656037ULL);
+
+        Fnv1aHash hash;
+        hash.addBytes("a", 1);
+        CHECK(hash.get() == 0xaf63dc4c8601ec8cULL);
+    }
+    THEN ("String concatenations are told apart") {
+        Fnv1aHash first;
+        first.addString("ab");
+        first.addString("c");
+        Fnv1aHash second;
+        second.addString("a");
+        second.addString("bc");
+        CHECK(first.get() != second.get());
+    }
+}
+
+SCENARIO("getHeapInUse")
+{
+    uint64_t before;
+    if (!getHeapInUse(before)) {
+        // Not reported by the allocator
+        return;
+    }
+    THEN ("Allocations are accounted for") {
+        const size_t size = 4 * 1024 * 1024;
+        std::unique_ptr<char[]> block(new char[size]);
+
+        uint64_t after;
+        REQUIRE(getHeapInUse(after));
+        CHECK(after >= before + size);
+    }
+}
+
 } // namespace utility
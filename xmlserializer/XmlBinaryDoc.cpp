@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "XmlBinaryDoc.h"
+#include <libxml/tree.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using std::string;
+using xml_unique_ptr = std::unique_ptr<xmlChar, decltype(xmlFree)>;
+
+void CXmlBinaryDoc::serialize(const _xmlDoc *doc, utility::BinaryWriter &writer)
+{
+    serialize(xmlDocGetRootElement(doc), writer);
+}
+
+void CXmlBinaryDoc::serialize(const _xmlNode *node, utility::BinaryWriter &writer)
+{
+    writer.writeString((const char *)node->name);
+
+    std::vector<const xmlAttr *> attributes;
+
+    for (const xmlAttr *attribute = node->properties; attribute != nullptr;
+         attribute = attribute->next) {
+
+        if (attribute->ns == nullptr) {
+
+            attributes.push_back(attribute);
+        }
+    }
+    writer.write(static_cast<uint32_t>(attributes.size()));
+
+    for (const xmlAttr *attribute : attributes) {
+
+        xml_unique_ptr value(xmlNodeListGetString(node->doc, attribute->children, 1), xmlFree);
+
+        writer.writeString((const char *)attribute->name);
+        writer.writeString(value ? (const char *)value.get() : "");
+    }
+
+    std::vector<const xmlNode *> children;
+
+    for (const xmlNode *child = node->children; child != nullptr; child = child->next) {
+
+        if (child->type == XML_ELEMENT_NODE) {
+
+            children.push_back(child);
+        }
+    }
+    writer.write(static_cast<uint32_t>(children.size()));
+
+    for (const xmlNode *child : children) {
+
+        serialize(child, writer);
+    }
+}
+
+_xmlDoc *CXmlBinaryDoc::deserialize(utility::BinaryReader &reader)
+{
+    xmlDocPtr doc = xmlNewDoc(BAD_CAST "1.0");
+    xmlNodePtr root = deserialize(doc, reader, 0);
+
+    if (root == nullptr || !reader.atEnd()) {
+
+        xmlFreeNode(root);
+        xmlFreeDoc(doc);
+        return nullptr;
+    }
+    xmlDocSetRootElement(doc, root);
+    return doc;
+}
+
+_xmlNode *CXmlBinaryDoc::deserialize(_xmlDoc *doc, utility::BinaryReader &reader, size_t depth)
+{
+    string name;
+
+    if (depth > gMaxDepth || !reader.readString(name) || name.empty()) {
+
+        return nullptr;
+    }
+    std::unique_ptr<xmlNode, decltype(xmlFreeNode) *> node(
+        xmlNewDocNode(doc, nullptr, BAD_CAST name.c_str(), nullptr), xmlFreeNode);
+
+    uint32_t nbAttributes;
+
+    if (!reader.read(nbAttributes)) {
+
+        return nullptr;
+    }
+    for (uint32_t attribute = 0; attribute < nbAttributes; attribute++) {
+
+        string value;
+
+        if (!reader.readString(name) || !reader.readString(value)) {
+
+            return nullptr;
+        }
+        xmlNewProp(node.get(), BAD_CAST name.c_str(), BAD_CAST value.c_str());
+    }
+
+    uint32_t nbChildren;
+
+    if (!reader.read(nbChildren)) {
+
+        return nullptr;
+    }
+    for (uint32_t child = 0; child < nbChildren; child++) {
+
+        xmlNodePtr childNode = deserialize(doc, reader, depth + 1);
+
+        if (childNode == nullptr) {
+
+            return nullptr;
+        }
+        xmlAddChild(node.get(), childNode);
+    }
+    return node.release();
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "BinaryBuffer.hpp"
+
+struct _xmlDoc;
+struct _xmlNode;
+
+/** Compact binary form of xml documents
+ *
+ * Only elements and their attributes are kept: text, comments and namespaced attributes, such
+ * as the xml:base ones set by XInclude, are dropped. Building a document back from its binary
+ * form neither tokenizes nor validates anything, hence is much faster than parsing it.
+ */
+class CXmlBinaryDoc
+{
+public:
+    /** Serialize a document
+     *
+     * @param[in] doc the document
+     * @param[out] writer receives the binary form
+     */
+    static void serialize(const _xmlDoc *doc, utility::BinaryWriter &writer);
+
+    /** Build a document back from its binary form
+     *
+     * @param[in] reader provides the binary form, which must end the data
+     * @return the document, to be freed by the caller, nullptr if the binary form is invalid
+     */
+    static _xmlDoc *deserialize(utility::BinaryReader &reader);
+
+private:
+    static void serialize(const _xmlNode *node, utility::BinaryWriter &writer);
+    static _xmlNode *deserialize(_xmlDoc *doc, utility::BinaryReader &reader, size_t depth);
+
+    /** Maximum element depth, guarding against corrupted binary forms */
+    static const size_t gMaxDepth = 256;
+};
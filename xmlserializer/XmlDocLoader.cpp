@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "XmlDocLoader.h"
+#include "XmlDocSource.h"
+#include "XmlSerializingContext.h"
+#include "ThreadPool.hpp"
+#include <libxml/parser.h>
+#include <libxml/tree.h>
+#include <libxml/uri.h>
+#include <libxml/xinclude.h>
+#include <algorithm>
+#include <memory>
+
+using std::string;
+using std::vector;
+using xml_unique_ptr = std::unique_ptr<xmlChar, decltype(xmlFree)>;
+
+namespace
+{
+
+bool isXInclude(xmlNodePtr node)
+{
+    return node->type == XML_ELEMENT_NODE && node->ns != nullptr &&
+           xmlStrEqual(node->name, XINCLUDE_NODE) &&
+           (xmlStrEqual(node->ns->href, XINCLUDE_NS) ||
+            xmlStrEqual(node->ns->href, XINCLUDE_OLD_NS));
+}
+
+/** List the XInclude elements below a node, in document order */
+void listXIncludes(xmlNodePtr node, vector<xmlNodePtr> &xincludes)
+{
+    for (xmlNodePtr child = node->children; child != nullptr; child = child->next) {
+
+        if (isXInclude(child)) {
+
+            xincludes.push_back(child);
+        } else if (child->type == XML_ELEMENT_NODE) {
+
+            listXIncludes(child, xincludes);
+        }
+    }
+}
+
+/** Build the URI of the file an XInclude refers to, as libxml2 does
+ *
+ * @return the URI, empty if the XInclude is not a plain inclusion of a whole xml document,
+ *         hence left to libxml2
+ */
+string xincludeUri(xmlDocPtr doc, xmlNodePtr xinclude)
+{
+    for (xmlNodePtr child = xinclude->children; child != nullptr; child = child->next) {
+
+        if (child->type == XML_ELEMENT_NODE) {
+            // Fallbacks
+            return "";
+        }
+    }
+    if (xmlHasProp(xinclude, BAD_CAST "xpointer") != nullptr ||
+        xmlHasNsProp(xinclude, BAD_CAST "base", XML_XML_NAMESPACE) != nullptr) {
+
+        return "";
+    }
+    xml_unique_ptr parse(xmlGetNoNsProp(xinclude, BAD_CAST "parse"), xmlFree);
+
+    if (parse != nullptr && !xmlStrEqual(parse.get(), BAD_CAST "xml")) {
+
+        return "";
+    }
+    xml_unique_ptr href(xmlGetNoNsProp(xinclude, BAD_CAST "href"), xmlFree);
+
+    if (href == nullptr || href.get()[0] == '\0') {
+
+        return "";
+    }
+    xml_unique_ptr base(xmlNodeGetBase(doc, xinclude), xmlFree);
+    xml_unique_ptr uri(xmlBuildURI(href.get(), base.get()), xmlFree);
+
+    if (uri == nullptr) {
+
+        return "";
+    }
+    std::unique_ptr<xmlURI, decltype(xmlFreeURI) *> parsedUri(
+        xmlParseURI((const char *)uri.get()), xmlFreeURI);
+
+    if (parsedUri == nullptr || parsedUri->fragment != nullptr) {
+
+        return "";
+    }
+    xml_unique_ptr url(xmlSaveUri(parsedUri.get()), xmlFree);
+
+    if (url == nullptr || xmlStrEqual(url.get(), doc->URL)) {
+
+        return "";
+    }
+    return (const char *)url.get();
+}
+
+void reportHandler(void *reported, _xmlError * /*error*/)
+{
+    *static_cast<bool *>(reported) = true;
+}
+
+/** Parse a file, leaving its XIncludes unresolved
+ *
+ * @return the document, nullptr if libxml2 reported anything while parsing it or if it has a
+ *         DTD, so that it is left to libxml2
+ */
+xmlDocPtr parseFile(const string &uri)
+{
+    // The handler is per thread
+    bool reported = false;
+    xmlSetStructuredErrorFunc(&reported, reportHandler);
+
+    xmlDocPtr doc = xmlReadFile(uri.c_str(), nullptr, 0);
+
+    xmlSetStructuredErrorFunc(nullptr, nullptr);
+
+    if (doc != nullptr && (reported || xmlGetIntSubset(doc) != nullptr)) {
+
+        xmlFreeDoc(doc);
+        doc = nullptr;
+    }
+    return doc;
+}
+
+} // namespace
+
+CXmlDocLoader::CXmlDocLoader(utility::ThreadPool *threadPool, const string &includeType)
+    : mThreadPool(threadPool), mIncludeType(includeType)
+{
+}
+
+CXmlDocLoader::~CXmlDocLoader()
+{
+    for (auto &parsed : mDocs) {
+
+        if (parsed.second.doc != nullptr) {
+
+            xmlFreeDoc(parsed.second.doc);
+        }
+    }
+}
+
+const vector<CXmlDocLoader::ParseTime> &CXmlDocLoader::getParseTimes() const
+{
+    return mParseTimes;
+}
+
+_xmlDoc *CXmlDocLoader::take(const string &uri, bool xincludes, vector<string> &sourceUris,
+                             CXmlSerializingContext &serializingContext)
+{
+    if (mDocs.find(uri) == mDocs.end()) {
+
+        preload(uri, serializingContext);
+    }
+    Entry &entry = mDocs[uri];
+
+    if (entry.doc == nullptr || (entry.expanded && !xincludes)) {
+
+        return nullptr;
+    }
+    if (xincludes && !entry.expanded) {
+
+        vector<string> chain{uri};
+        expand(entry.doc, chain, entry.includedUris);
+        entry.expanded = true;
+    }
+    sourceUris.push_back(uri);
+    sourceUris.insert(end(sourceUris), begin(entry.includedUris), end(entry.includedUris));
+
+    _xmlDoc *doc = entry.doc;
+    entry.doc = nullptr;
+
+    return doc;
+}
+
+void CXmlDocLoader::preload(const string &uri, CXmlSerializingContext &serializingContext)
+{
+    vector<string> level{uri};
+
+    while (not level.empty()) {
+
+        vector<xmlDocPtr> docs(level.size());
+        vector<std::chrono::microseconds> durations(level.size());
+
+        auto parse = [&](size_t index) {
+            auto start = std::chrono::steady_clock::now();
+
+            docs[index] = parseFile(level[index]);
+
+            durations[index] = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start);
+        };
+        if (mThreadPool != nullptr) {
+
+            mThreadPool->parallelFor(level.size(), parse);
+        } else {
+
+            for (size_t index = 0; index < level.size(); ++index) {
+                parse(index);
+            }
+        }
+        // Register the whole level before looking for the files of the next one
+        for (size_t index = 0; index < level.size(); ++index) {
+
+            mDocs[level[index]] = Entry{docs[index], false, false, {}};
+            mParseTimes.push_back(ParseTime{level[index], durations[index]});
+        }
+        vector<string> next;
+
+        for (xmlDocPtr doc : docs) {
+
+            if (doc == nullptr) {
+                continue;
+            }
+            vector<string> includes;
+            listIncludes(doc, includes);
+
+            for (const auto &include : includes) {
+
+                if (mDocs.find(include) == mDocs.end() &&
+                    std::find(begin(next), end(next), include) == end(next)) {
+
+                    next.push_back(include);
+                }
+            }
+        }
+        level.swap(next);
+    }
+    // Parsing unset the error handler of this thread
+    xmlSetStructuredErrorFunc(&serializingContext, CXmlSerializingContext::structuredErrorHandler);
+}
+
+void CXmlDocLoader::listIncludes(_xmlDoc *doc, vector<string> &uris) const
+{
+    xmlNodePtr root = xmlDocGetRootElement(doc);
+
+    if (root == nullptr) {
+
+        return;
+    }
+    vector<xmlNodePtr> xincludes;
+    listXIncludes(root, xincludes);
+
+    for (xmlNodePtr xinclude : xincludes) {
+
+        string uri = xincludeUri(doc, xinclude);
+
+        if (not uri.empty()) {
+
+            uris.push_back(uri);
+        }
+    }
+    if (mIncludeType.empty() || doc->URL == nullptr) {
+
+        return;
+    }
+    for (xmlNodePtr child = root->children; child != nullptr; child = child->next) {
+
+        if (child->type == XML_ELEMENT_NODE && mIncludeType == (const char *)child->name) {
+
+            xml_unique_ptr path(xmlGetProp(child, BAD_CAST "Path"), xmlFree);
+
+            if (path != nullptr) {
+
+                uris.push_back(CXmlDocSource::mkUri((const char *)doc->URL,
+                                                    (const char *)path.get()));
+            }
+        }
+    }
+}
+
+bool CXmlDocLoader::expand(_xmlDoc *doc, vector<string> &chain, vector<string> &includedUris)
+{
+    xmlNodePtr root = xmlDocGetRootElement(doc);
+
+    if (root == nullptr) {
+
+        return true;
+    }
+    bool complete = true;
+
+    vector<xmlNodePtr> xincludes;
+    listXIncludes(root, xincludes);
+
+    for (xmlNodePtr xinclude : xincludes) {
+
+        string uri = xincludeUri(doc, xinclude);
+
+        if (uri.empty()) {
+            // Let libxml2 resolve it
+            continue;
+        }
+        if (std::find(begin(chain), end(chain), uri) != end(chain)) {
+            // Let libxml2 report the loop from the including document
+            complete = false;
+            continue;
+        }
+        auto found = mDocs.find(uri);
+
+        if (found == mDocs.end() || found->second.doc == nullptr) {
+
+            continue;
+        }
+        Entry &entry = found->second;
+
+        if (not entry.expanded) {
+
+            chain.push_back(uri);
+            entry.looping = !expand(entry.doc, chain, entry.includedUris);
+            chain.pop_back();
+            entry.expanded = true;
+        }
+        if (entry.looping) {
+            // Inlining it would change how libxml2 reports the loop
+            complete = false;
+            continue;
+        }
+        xmlNodePtr includedRoot = xmlDocGetRootElement(entry.doc);
+
+        if (includedRoot == nullptr ||
+            xmlHasNsProp(includedRoot, BAD_CAST "base", XML_XML_NAMESPACE) != nullptr) {
+
+            continue;
+        }
+        // As libxml2, only set the base of the included elements if not in the same folder
+        xml_unique_ptr relativeUri(xmlBuildRelativeURI(BAD_CAST uri.c_str(), doc->URL),
+                                   xmlFree);
+        bool setBase = relativeUri != nullptr && xmlStrchr(relativeUri.get(), '/') != nullptr;
+
+        // As libxml2, turn the XInclude into a start marker followed by the included nodes
+        // and an end marker
+        while (xinclude->children != nullptr) {
+
+            xmlNodePtr child = xinclude->children;
+            xmlUnlinkNode(child);
+            xmlFreeNode(child);
+        }
+        xinclude->type = XML_XINCLUDE_START;
+
+        xmlNodePtr endMarker = xmlNewDocNode(doc, xinclude->ns, xinclude->name, nullptr);
+        endMarker->type = XML_XINCLUDE_END;
+        xmlAddNextSibling(xinclude, endMarker);
+
+        for (xmlNodePtr child = entry.doc->children; child != nullptr; child = child->next) {
+
+            if (child->type == XML_DTD_NODE) {
+                continue;
+            }
+            xmlNodePtr copy = xmlDocCopyNode(child, doc, 1);
+
+            if (setBase && copy->type == XML_ELEMENT_NODE) {
+
+                xmlNodeSetBase(copy, relativeUri.get());
+            }
+            xmlAddPrevSibling(endMarker, copy);
+        }
+        if (std::find(begin(includedUris), end(includedUris), uri) == end(includedUris)) {
+
+            includedUris.push_back(uri);
+        }
+        for (const auto &nested : entry.includedUris) {
+
+            if (std::find(begin(includedUris), end(includedUris), nested) == end(includedUris)) {
+
+                includedUris.push_back(nested);
+            }
+        }
+    }
+    return complete;
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "NonCopyable.hpp"
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+struct _xmlDoc;
+class CXmlSerializingContext;
+
+namespace utility
+{
+class ThreadPool;
+} // namespace utility
+
+/** Loads xml files along with the files they include, parsing them concurrently
+ *
+ * When a file is requested, the files it XIncludes, and the files its file inclusion elements
+ * refer to, are discovered and parsed level by level, the files of a level being parsed
+ * concurrently. XIncludes are then resolved from the parsed documents in document order, the
+ * way libxml2 resolves them.
+ *
+ * Anything out of the ordinary, such as XPointers, text inclusions, DTDs or files which fail to
+ * parse, is left to libxml2: it then resolves, or reports, it as if there were no loader.
+ */
+class CXmlDocLoader : private utility::NonCopyable
+{
+public:
+    /** Time spent parsing a file */
+    struct ParseTime
+    {
+        std::string uri;
+        std::chrono::microseconds duration;
+    };
+
+    /**
+     * @param[in] threadPool the pool parsing files, not owned, nullptr to parse them serially
+     * @param[in] includeType the type of the file inclusion elements, which are children of
+     *            root elements whose Path attribute refers to a file relative to the including
+     *            one, as handled by CXmlFileIncluderElement; empty if there are none
+     */
+    CXmlDocLoader(utility::ThreadPool *threadPool, const std::string &includeType = "");
+    ~CXmlDocLoader();
+
+    /** Take the document of a file, parsing it and the files it includes if not done yet
+     *
+     * @param[in] uri the file URI
+     * @param[in] xincludes if true, resolve the XIncludes of the document from parsed files
+     * @param[out] sourceUris receives the URIs of the files the document is made of, the file
+     *             first
+     * @param[in] serializingContext the context receiving the libxml2 errors of this thread
+     *
+     * @return the document, to be freed by the caller, its remaining XIncludes being left to
+     *         libxml2; nullptr if the file could not be parsed without error, or has already
+     *         been taken
+     */
+    _xmlDoc *take(const std::string &uri, bool xincludes, std::vector<std::string> &sourceUris,
+                  CXmlSerializingContext &serializingContext);
+
+    /** @return the time spent parsing each file, in parsing order */
+    const std::vector<ParseTime> &getParseTimes() const;
+
+private:
+    struct Entry
+    {
+        /** nullptr if the file could not be parsed or has been taken */
+        _xmlDoc *doc;
+        /** Are the XIncludes of the document resolved */
+        bool expanded;
+        /** Does the document include itself, possibly indirectly */
+        bool looping;
+        /** The URIs of the files the document XIncludes, once expanded */
+        std::vector<std::string> includedUris;
+    };
+
+    /** Parse a file and, level by level, the files it includes */
+    void preload(const std::string &uri, CXmlSerializingContext &serializingContext);
+
+    /** List the URIs of the files a document includes, in document order */
+    void listIncludes(_xmlDoc *doc, std::vector<std::string> &uris) const;
+
+    /** Resolve the XIncludes of a document from the parsed files
+     *
+     * @param[in,out] doc the document
+     * @param[in,out] chain the URIs of the documents being expanded, to leave loops to libxml2
+     * @param[out] includedUris receives the URIs of the files included
+     * @return false if XIncludes looping back to a document of the chain were left to libxml2
+     */
+    bool expand(_xmlDoc *doc, std::vector<std::string> &chain,
+                std::vector<std::string> &includedUris);
+
+    utility::ThreadPool *mThreadPool;
+    const std::string mIncludeType;
+
+    /** Parsed files by URI */
+    std::map<std::string, Entry> mDocs;
+    std::vector<ParseTime> mParseTimes;
+};
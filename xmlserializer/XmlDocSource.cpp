@@ -29,13 +29,17 @@
  */
 
 #include "XmlDocSource.h"
+#include "XmlDocLoader.h"
 #include "AlwaysAssert.hpp"
 #include <libxml/tree.h>
 #include <libxml/xmlschemas.h>
 #include <libxml/parser.h>
 #include <libxml/xinclude.h>
 #include <libxml/uri.h>
+#include <libxml/parserInternals.h>
+#include <algorithm>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 
 using std::string;
@@ -230,11 +234,100 @@ std::string CXmlDocSource::mkUri(const std::string &base, const std::string &rel
     return (const char *)xmlUri.get();
 }
 
+std::string CXmlDocSource::mkPath(const std::string &uri)
+{
+    std::unique_ptr<xmlURI, decltype(xmlFreeURI) *> parsedUri(xmlParseURI(uri.c_str()),
+                                                              xmlFreeURI);
+
+    if (parsedUri == nullptr || parsedUri->path == nullptr ||
+        (parsedUri->scheme != nullptr && string(parsedUri->scheme) != "file")) {
+
+        return "";
+    }
+    // xmlParseURI unescapes the path
+    return parsedUri->path;
+}
+
+namespace
+{
+
+/** URIs loaded by the current thread, if recorded */
+thread_local std::vector<string> *gLoadedUris = nullptr;
+
+/** The loader replaced by recordingLoader */
+xmlExternalEntityLoader gDefaultLoader = nullptr;
+
+/** Record URIs as loaded, if recorded */
+void recordLoads(const std::vector<string> &uris)
+{
+    if (gLoadedUris == nullptr) {
+        return;
+    }
+    for (const auto &uri : uris) {
+
+        if (std::find(begin(*gLoadedUris), end(*gLoadedUris), uri) == end(*gLoadedUris)) {
+
+            gLoadedUris->push_back(uri);
+        }
+    }
+}
+
+xmlParserInputPtr recordingLoader(const char *url, const char *id, xmlParserCtxtPtr context)
+{
+    if (gLoadedUris != nullptr && url != nullptr &&
+        std::find(begin(*gLoadedUris), end(*gLoadedUris), url) == end(*gLoadedUris)) {
+
+        gLoadedUris->push_back(url);
+    }
+    return gDefaultLoader(url, id, context);
+}
+
+/** Record the URIs of the files loaded by libxml2 during its lifetime */
+class LoadRecorder
+{
+public:
+    LoadRecorder(std::vector<string> &uris) : mLock(gMutex)
+    {
+        gDefaultLoader = xmlGetExternalEntityLoader();
+        xmlSetExternalEntityLoader(recordingLoader);
+        gLoadedUris = &uris;
+    }
+    ~LoadRecorder()
+    {
+        gLoadedUris = nullptr;
+        xmlSetExternalEntityLoader(gDefaultLoader);
+    }
+
+private:
+    static std::mutex gMutex;
+    std::lock_guard<std::mutex> mLock;
+};
+
+std::mutex LoadRecorder::gMutex;
+
+} // namespace
+
 _xmlDoc *CXmlDocSource::mkXmlDoc(const string &source, bool fromFile, bool xincludes,
                                  CXmlSerializingContext &serializingContext)
 {
     _xmlDoc *doc = nullptr;
-    if (fromFile) {
+    CXmlDocLoader *docLoader = serializingContext.getDocLoader();
+
+    if (fromFile && docLoader != nullptr) {
+
+        // Files are parsed by other threads too, record them here rather than when loaded
+        std::vector<string> *loadedUris = gLoadedUris;
+        gLoadedUris = nullptr;
+
+        std::vector<string> sourceUris;
+        doc = docLoader->take(source, xincludes, sourceUris, serializingContext);
+
+        gLoadedUris = loadedUris;
+        recordLoads(sourceUris);
+    }
+    if (doc != nullptr) {
+        // Already parsed
+    } else if (fromFile) {
         doc = xmlReadFile(source.c_str(), nullptr, 0);
     } else {
         doc = xmlReadMemory(source.c_str(), (int)source.size(), "", nullptr, 0);
@@ -259,3 +352,48 @@ _xmlDoc *CXmlDocSource::mkXmlDoc(const string &source, bool fromFile, bool xincl
 
     return doc;
 }
+
+_xmlDoc *CXmlDocSource::mkExpandedXmlDoc(const string &source, const string &includeType,
+                                         std::vector<string> &sourceUris,
+                                         CXmlSerializingContext &serializingContext)
+{
+    LoadRecorder recorder(sourceUris);
+
+    _xmlDoc *doc = mkXmlDoc(source, true, true, serializingContext);
+
+    if (doc == nullptr) {
+
+        return nullptr;
+    }
+    // Gather inclusions first, as they are replaced
+    std::vector<xmlNodePtr> inclusions;
+
+    for (xmlNodePtr node = xmlDocGetRootElement(doc)->children; node != nullptr;
+         node = node->next) {
+
+        if (node->type == XML_ELEMENT_NODE && includeType == (const char *)node->name) {
+
+            inclusions.push_back(node);
+        }
+    }
+    for (xmlNodePtr inclusion : inclusions) {
+
+        string path;
+        CXmlElement(inclusion).getAttribute("Path", path);
+
+        _xmlDoc *includedDoc = mkXmlDoc(mkUri(source, path), true, true, serializingContext);
+
+        if (includedDoc == nullptr) {
+
+            xmlFreeDoc(doc);
+            return nullptr;
+        }
+        xmlNodePtr includedRoot = xmlDocCopyNode(xmlDocGetRootElement(includedDoc), doc, 1);
+
+        xmlFreeDoc(includedDoc);
+
+        xmlReplaceNode(inclusion, includedRoot);
+        xmlFreeNode(inclusion);
+    }
+    return doc;
+}
@@ -35,6 +35,7 @@
 #include "NonCopyable.hpp"
 
 #include <string>
+#include <vector>
 
 struct _xmlDoc;
 struct _xmlNode;
@@ -157,6 +158,14 @@ public:
      */
     static std::string mkUri(const std::string &base, const std::string &relative);
 
+    /** Helper method converting a local file URI, as made by mkUri, to a file system path
+     *
+     * @param[in] uri the URI, either a path or a "file" scheme URI
+     *
+     * @return the unescaped path, empty if uri does not designate a local file
+     */
+    static std::string mkPath(const std::string &uri);
+
     /**
      * Helper method for creating an xml document from either a file or a
      * string.
@@ -165,11 +174,32 @@ public:
      * @param[in] fromFile true if source is a filename, false if source is an xml
      *            represents an xml document
      * @param[in] xincludes if true, process xincludes tags
-     * @param[in] serializingContext will receive any serialization error
+     * @param[in] serializingContext will receive any serialization error; files are taken
+     *            from its document loader, if any
      */
     static _xmlDoc *mkXmlDoc(const std::string &source, bool fromFile, bool xincludes,
                              CXmlSerializingContext &serializingContext);
 
+    /**
+     * Helper method creating an xml document from a file, resolving both XIncludes and file
+     * inclusions, and listing the files the document is made of.
+     *
+     * File inclusions are the children of the root element of the given type. Each one is
+     * replaced by the root element of the document its Path attribute refers to, relative to
+     * the source file, as CXmlFileIncluderElement would do.
+     *
+     * As the libxml2 external entity loader is temporarily replaced to list the files, other
+     * threads must not rely on it while the document is being created.
+     *
+     * @param[in] source the file name
+     * @param[in] includeType the type of the file inclusion elements
+     * @param[out] sourceUris the URIs of all the files read, the source first
+     * @param[in] serializingContext will receive any serialization error
+     */
+    static _xmlDoc *mkExpandedXmlDoc(const std::string &source, const std::string &includeType,
+                                     std::vector<std::string> &sourceUris,
+                                     CXmlSerializingContext &serializingContext);
+
 protected:
     /**
       * Doc
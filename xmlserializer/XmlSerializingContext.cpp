@@ -64,3 +64,13 @@ void CXmlSerializingContext::structuredErrorHandler(void *userData, xmlErrorPtr
     self->_strXmlError += filename + ":" + std::to_string(error->line) + ":" +
                           std::to_string(error->int2) + ": " + error->message;
 }
+
+void CXmlSerializingContext::setDocLoader(CXmlDocLoader *pDocLoader)
+{
+    _pDocLoader = pDocLoader;
+}
+
+CXmlDocLoader *CXmlSerializingContext::getDocLoader() const
+{
+    return _pDocLoader;
+}
@@ -36,6 +36,8 @@
 /** Forward declare libxml2 handler structure. */
 struct _xmlError;
 
+class CXmlDocLoader;
+
 /** Class that gather errors during serialization.
  *
  * Provided with an initial empty buffer (strError), an instance of this class
@@ -63,6 +65,16 @@ public:
       */
     static void structuredErrorHandler(void *userData, _xmlError *error);
 
+    /** Set the loader providing the documents of the files to parse
+      *
+      * @param[in] pDocLoader the loader, not owned, nullptr to parse files when needed
+      */
+    void setDocLoader(CXmlDocLoader *pDocLoader);
+    /** @return the loader providing the documents of the files to parse, if any */
+    CXmlDocLoader *getDocLoader() const;
+
 private:
     std::string _strXmlError;
+
+    CXmlDocLoader *_pDocLoader{nullptr};
 };